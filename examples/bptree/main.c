@@ -0,0 +1,162 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "bistree.h"
+#include "bptree.h"
+
+#define MIN_KEYS (10000)
+#define MAX_KEYS (10000000)
+
+int compare_int(const void *key1, const void *key2)
+{
+    int a = *(const int *)key1, b = *(const int *)key2;
+
+    return a < b ? -1 : a > b;
+}
+
+int sum_int(const void *data, void *ctx)
+{
+    *(long long *)ctx += *(const int *)data;
+
+    return 0;
+}
+
+double elapsed(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+void bench(int *keys, int *order, void **sorted, int n)
+{
+    BisTree bistree;
+    BPTree bptree;
+    clock_t start;
+    long long sum;
+    void *data;
+    int i, found;
+
+    /* Insert the keys in random order, then look them all up in the reverse order. */
+    bistree_init_pooled(&bistree, 0, compare_int, NULL);
+    start = clock();
+
+    for (i = 0; i < n; i++)
+        bistree_insert(&bistree, &keys[order[i]]);
+
+    printf("%10d  insert  bistree %7.3fs", n, elapsed(start));
+
+    bptree_init(&bptree, compare_int, NULL);
+    start = clock();
+
+    for (i = 0; i < n; i++)
+        bptree_insert(&bptree, &keys[order[i]]);
+
+    printf("  bptree %7.3fs\n", elapsed(start));
+
+    start = clock();
+
+    for (i = found = 0; i < n; i++)
+    {
+        data = &keys[order[n - 1 - i]];
+        found += bistree_lookup(&bistree, &data) == 0;
+    }
+
+    printf("%10s  lookup  bistree %7.3fs", "", elapsed(start));
+    start = clock();
+
+    for (i = found = 0; i < n; i++)
+    {
+        data = &keys[order[n - 1 - i]];
+        found += bptree_lookup(&bptree, &data) == 0;
+    }
+
+    printf("  bptree %7.3fs%s\n", elapsed(start), found == n ? "" : " (missing keys!)");
+
+    /* Scan every key in order. */
+    sum = 0;
+    start = clock();
+    bistree_range(&bistree, NULL, NULL, sum_int, &sum);
+    printf("%10s  scan    bistree %7.3fs", "", elapsed(start));
+
+    sum = 0;
+    start = clock();
+    bptree_range(&bptree, NULL, NULL, sum_int, &sum);
+    printf("  bptree %7.3fs\n", elapsed(start));
+
+    bistree_destroy(&bistree);
+    bptree_destroy(&bptree);
+
+    /* Build the tree from the sorted keys at once instead. */
+    bptree_init(&bptree, compare_int, NULL);
+    start = clock();
+    bptree_load(&bptree, sorted, n);
+    printf("%10s  load                    bptree %7.3fs\n", "", elapsed(start));
+    bptree_destroy(&bptree);
+
+    return;
+}
+
+void shuffle(int *order, int n)
+{
+    int i, j, temp;
+
+    /* Make a random order of the first n keys. */
+    for (i = 0; i < n; i++)
+        order[i] = i;
+
+    for (i = n - 1; i > 0; i--)
+    {
+        j = (int)(((double)rand() / ((double)RAND_MAX + 1)) * (i + 1));
+        temp = order[i];
+        order[i] = order[j];
+        order[j] = temp;
+    }
+
+    return;
+}
+
+int main(int argc, char **argv)
+{
+    void **sorted;
+    int *keys, *order;
+    int i, n, max;
+
+    /* Take the largest number of keys from the command line, up to 10^8 for machines with room. */
+    max = argc > 1 ? atoi(argv[1]) : MAX_KEYS;
+
+    if (max < MIN_KEYS)
+        max = MIN_KEYS;
+
+    keys = (int *)malloc(max * sizeof(int));
+    order = (int *)malloc(max * sizeof(int));
+    sorted = (void **)malloc(max * sizeof(void *));
+
+    if (keys == NULL || order == NULL || sorted == NULL)
+    {
+        free(keys);
+        free(order);
+        free(sorted);
+        return EXIT_FAILURE;
+    }
+
+    /* Make distinct keys in order. */
+    for (i = 0; i < max; i++)
+    {
+        keys[i] = 2 * i;
+        sorted[i] = &keys[i];
+    }
+
+    srand(1);
+
+    for (n = MIN_KEYS; n <= max; n *= 10)
+    {
+        shuffle(order, n);
+        bench(keys, order, sorted, n);
+    }
+
+    free(sorted);
+    free(keys);
+    free(order);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,64 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "extsort.h"
+
+/* The size of the records, whose bytes are compared as an unsigned big-endian key. */
+static int record_size;
+
+int compare_record(const void *key1, const void *key2)
+{
+    int retval = memcmp(key1, key2, record_size);
+
+    return retval < 0 ? -1 : retval > 0;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *in, *out;
+    clock_t start;
+    size_t memory;
+    int retval;
+
+    if (argc != 5)
+    {
+        fprintf(stderr, "usage: %s record-size memory-mb input output\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    record_size = atoi(argv[1]);
+    memory = (size_t)atol(argv[2]) * 1024 * 1024;
+
+    if ((in = fopen(argv[3], "rb")) == NULL)
+    {
+        perror(argv[3]);
+        return EXIT_FAILURE;
+    }
+
+    if ((out = fopen(argv[4], "wb")) == NULL)
+    {
+        perror(argv[4]);
+        fclose(in);
+        return EXIT_FAILURE;
+    }
+
+    start = clock();
+    retval = extsort(in, out, record_size, memory, 0, compare_record);
+
+    if (fclose(out) != 0)
+        retval = -1;
+
+    fclose(in);
+
+    if (retval != 0)
+    {
+        fprintf(stderr, "%s: sorting failed\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    printf("sorted in %.3fs of processor time\n", (double)(clock() - start) / CLOCKS_PER_SEC);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "set.h"
+#include "hset.h"
+
+/* Sets larger than this are not timed with the list-based set. */
+#define SET_MAX_MEMBERS (20000)
+
+#define MIN_MEMBERS (1000)
+#define MAX_MEMBERS (10000000)
+
+int match_int(const void *key1, const void *key2)
+{
+    return *(const int *)key1 == *(const int *)key2;
+}
+
+int hash_int(const void *key)
+{
+    /* Spread consecutive keys with a multiplicative hash. */
+    return (int)((*(const unsigned int *)key * 2654435761U) >> 1);
+}
+
+double elapsed(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+void bench_set(int *keys, int n)
+{
+    Set set1, set2, setu;
+    clock_t start;
+    int i, found = 0;
+
+    set_init(&set1, match_int, NULL);
+    set_init(&set2, match_int, NULL);
+
+    start = clock();
+    for (i = 0; i < n; i++)
+        set_insert(&set1, &keys[i]);
+    printf("%10d  set   insert %9.3fs", n, elapsed(start));
+
+    start = clock();
+    for (i = 0; i < n; i++)
+        found += set_is_member(&set1, &keys[n - 1 - i]);
+    printf("  member %9.3fs", elapsed(start));
+
+    for (i = n / 2; i < n + n / 2; i++)
+        set_insert(&set2, &keys[i]);
+
+    start = clock();
+    set_union(&setu, &set1, &set2);
+    printf("  union %9.3fs  (%d found)\n", elapsed(start), found);
+
+    set_destroy(&setu);
+    set_destroy(&set2);
+    set_destroy(&set1);
+}
+
+void bench_hset(int *keys, int n)
+{
+    HSet set1, set2, setu;
+    clock_t start;
+    int i, found = 0;
+
+    hset_init(&set1, n, hash_int, match_int, NULL);
+    hset_init(&set2, n, hash_int, match_int, NULL);
+
+    start = clock();
+    for (i = 0; i < n; i++)
+        hset_insert(&set1, &keys[i]);
+    printf("%10d  hset  insert %9.3fs", n, elapsed(start));
+
+    start = clock();
+    for (i = 0; i < n; i++)
+        found += hset_is_member(&set1, &keys[n - 1 - i]);
+    printf("  member %9.3fs", elapsed(start));
+
+    for (i = n / 2; i < n + n / 2; i++)
+        hset_insert(&set2, &keys[i]);
+
+    start = clock();
+    hset_union(&setu, &set1, &set2);
+    printf("  union %9.3fs  (%d found)\n", elapsed(start), found);
+
+    hset_destroy(&setu);
+    hset_destroy(&set2);
+    hset_destroy(&set1);
+}
+
+int main()
+{
+    int *keys;
+    int i, n;
+
+    /* Allocate room for the members of both sets at the largest size. */
+    if ((keys = (int *)malloc((MAX_MEMBERS + MAX_MEMBERS / 2) * sizeof(int))) == NULL)
+        return EXIT_FAILURE;
+
+    for (i = 0; i < MAX_MEMBERS + MAX_MEMBERS / 2; i++)
+        keys[i] = i;
+
+    for (n = MIN_MEMBERS; n <= MAX_MEMBERS; n *= 10)
+    {
+        if (n <= SET_MAX_MEMBERS)
+            bench_set(keys, n);
+        else
+            printf("%10d  set   skipped, O(n^2) insertion\n", n);
+
+        bench_hset(keys, n);
+    }
+
+    free(keys);
+    return 0;
+}
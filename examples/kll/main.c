@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "kll.h"
+#include "select.h"
+
+#define SAMPLES (10000000)
+#define SKETCHES (8)
+
+double elapsed(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int exact(const int *samples, int *scratch, int n, double q)
+{
+    int k = (int)(q * (n - 1));
+
+    /* Select the exact quantile, as median() does for q = 0.5. */
+    memcpy(scratch, samples, n * sizeof(int));
+    select_kth_int(scratch, n, k);
+
+    return scratch[k];
+}
+
+double rank(const int *samples, int n, double value)
+{
+    int i, count = 0;
+
+    /* Determine the exact fraction of the samples less than or equal to value. */
+    for (i = 0; i < n; i++)
+        count += samples[i] <= value;
+
+    return (double)count / n;
+}
+
+int main(void)
+{
+    static const double quantiles[] = {0.5, 0.9, 0.99};
+    static const int ks[] = {50, 200, 800};
+    KLL kll, parts[SKETCHES], merged;
+    int *samples, *scratch;
+    double value, err;
+    clock_t start;
+    int i, j, q, want;
+
+    if ((samples = (int *)malloc(SAMPLES * sizeof(int))) == NULL)
+        return 1;
+
+    if ((scratch = (int *)malloc(SAMPLES * sizeof(int))) == NULL)
+    {
+        free(samples);
+        return 1;
+    }
+
+    /* Draw skewed samples, like latencies: most small, a long tail of large ones. */
+    srand(1);
+
+    for (i = 0; i < SAMPLES; i++)
+        samples[i] = (rand() % 1000) * (rand() % 1000 == 0 ? 1000 : 1) + rand() % 100;
+
+    for (j = 0; j < (int)(sizeof(ks) / sizeof(ks[0])); j++)
+    {
+        /* Summarize all the samples in one sketch. */
+        kll_init(&kll, ks[j]);
+        start = clock();
+
+        for (i = 0; i < SAMPLES; i++)
+            kll_insert(&kll, samples[i]);
+
+        printf("k=%4d  insert %7.3fs  kept %5d values for %d\n", ks[j], elapsed(start),
+               kll_kept(&kll), SAMPLES);
+
+        /* Summarize the samples in parts, as threads or hosts would, and merge the parts. */
+        kll_init(&merged, ks[j]);
+
+        for (i = 0; i < SKETCHES; i++)
+            kll_init(&parts[i], ks[j]);
+
+        for (i = 0; i < SAMPLES; i++)
+            kll_insert(&parts[i % SKETCHES], samples[i]);
+
+        for (i = 0; i < SKETCHES; i++)
+        {
+            kll_merge(&merged, &parts[i]);
+            kll_destroy(&parts[i]);
+        }
+
+        /* Compare the quantiles estimated with the exact ones, in rank and in value. */
+        for (q = 0; q < (int)(sizeof(quantiles) / sizeof(quantiles[0])); q++)
+        {
+            start = clock();
+            want = exact(samples, scratch, SAMPLES, quantiles[q]);
+            printf("        p%-4g exact %7d (%.3fs)", quantiles[q] * 100, want, elapsed(start));
+
+            kll_quantile(&kll, quantiles[q], &value);
+            err = rank(samples, SAMPLES, value) - quantiles[q];
+            printf("  sketch %7.0f (rank error %+.4f)", value, err);
+
+            kll_quantile(&merged, quantiles[q], &value);
+            err = rank(samples, SAMPLES, value) - quantiles[q];
+            printf("  merged %7.0f (rank error %+.4f)\n", value, err);
+        }
+
+        kll_destroy(&merged);
+        kll_destroy(&kll);
+    }
+
+    free(scratch);
+    free(samples);
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sort.h"
+#include "typesort.h"
+
+#define MIN_ELEMENTS (1000)
+#define MAX_ELEMENTS (10000000)
+
+typedef struct Point_ {
+    int x;
+    int y;
+} Point;
+
+DEFINE_SORT(int, int, a < b)
+DEFINE_SORT(u64, uint64_t, a < b)
+DEFINE_SORT(point, Point, a.x < b.x || (a.x == b.x && a.y < b.y))
+
+int compare_int(const void *key1, const void *key2)
+{
+    int a = *(const int *)key1, b = *(const int *)key2;
+
+    return a < b ? -1 : a > b;
+}
+
+double elapsed(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int sorted(const int *data, int n)
+{
+    int i;
+
+    for (i = 1; i < n; i++)
+    {
+        if (data[i - 1] > data[i])
+            return 0;
+    }
+
+    return 1;
+}
+
+void bench(const int *keys, int *data, int n)
+{
+    clock_t start;
+
+    memcpy(data, keys, n * sizeof(int));
+    start = clock();
+    qksort(data, n, sizeof(int), 0, n - 1, compare_int);
+    printf("%10d  qksort %8.3fs", n, elapsed(start));
+
+    memcpy(data, keys, n * sizeof(int));
+    start = clock();
+    int_qksort(data, n);
+    printf("  int_qksort %8.3fs%s", elapsed(start), sorted(data, n) ? "" : " (unsorted!)");
+
+    memcpy(data, keys, n * sizeof(int));
+    start = clock();
+    mgsort(data, n, sizeof(int), 0, n - 1, compare_int);
+    printf("  mgsort %8.3fs", elapsed(start));
+
+    memcpy(data, keys, n * sizeof(int));
+    start = clock();
+    int_mgsort(data, n);
+    printf("  int_mgsort %8.3fs%s\n", elapsed(start), sorted(data, n) ? "" : " (unsorted!)");
+}
+
+int main(void)
+{
+    int *keys, *data;
+    int i, n;
+
+    if ((keys = (int *)malloc(MAX_ELEMENTS * sizeof(int))) == NULL)
+        return 1;
+
+    if ((data = (int *)malloc(MAX_ELEMENTS * sizeof(int))) == NULL)
+    {
+        free(keys);
+        return 1;
+    }
+
+    srand(1);
+
+    for (i = 0; i < MAX_ELEMENTS; i++)
+        keys[i] = rand();
+
+    for (n = MIN_ELEMENTS; n <= MAX_ELEMENTS; n *= 10)
+        bench(keys, data, n);
+
+    free(data);
+    free(keys);
+
+    return 0;
+}
@@ -0,0 +1,145 @@
+/* Header for the Array-Backed Queue Abstract Datatype */
+
+#ifndef AQUEUE_H
+#define AQUEUE_H
+
+#include <stdlib.h>
+
+/* 
+ * Implement array-backed queues as circular buffers whose capacity
+ * is always a power of two.
+ */
+typedef struct AQueue_
+{
+    int size;
+    int capacity;
+    int head;
+
+    void (*destroy)(void *data);
+
+    void **slots;
+} AQueue;
+
+/* --------------------- Public Interface ------------------------ */
+
+/*
+ * Description: Initializes the array-backed queue specified by queue.
+ * This operation must be called for a queue before the queue can be
+ * used with any other operation. No storage is allocated until the
+ * first element is enqueued or aqueue_reserve is called. The destroy
+ * argument works in a manner similar to that described for
+ * queue_init. For a queue containing data that should not be freed,
+ * destroy should be set to NULL.
+ * 
+ * Return Value: None.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+void aqueue_init(AQueue *queue, void (*destroy)(void *data));
+
+/*
+ * Description: Destroys the array-backed queue specified by queue. No
+ * other operations are permitted after calling aqueue_destroy unless
+ * aqueue_init is called again. The aqueue_destroy operation removes
+ * all elements from a queue and calls the function passed as destroy
+ * to aqueue_init once for each element as it is removed, provided
+ * destroy was not set to NULL.
+ * 
+ * Return Value: None.
+ * 
+ * Complexity: O(n), where n is the number of elements in the queue.
+ * 
+ */
+void aqueue_destroy(AQueue *queue);
+
+/*
+ * Description: Enqueues an element at the tail of the array-backed
+ * queue specified by queue. The capacity of the queue is doubled when
+ * it is full. The memory referenced by data should remain valid as
+ * long as the element remains in the queue.
+ * 
+ * Return Value: 0 if enqueuing the element is succesful, or
+ * -1 otherwise.
+ * 
+ * Complexity: Amortized O(1)
+ * 
+ */
+int aqueue_enqueue(AQueue *queue, const void *data);
+
+/*
+ * Description: Dequeues an element from the head of the array-backed
+ * queue specified by queue. Upon return, data points to the data
+ * stored in the element that was dequeued. The capacity of the queue
+ * is never reduced by this operation; see aqueue_shrink_to_fit.
+ * 
+ * Return Value: 0 if dequeuing the element is succesful, or
+ * -1 otherwise.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+int aqueue_dequeue(AQueue *queue, void **data);
+
+/*
+ * Description: Ensures that the array-backed queue specified by
+ * queue can hold at least capacity elements without allocating
+ * again. The capacity is rounded up to a power of two.
+ * 
+ * Return Value: 0 if reserving the storage is succesful, or
+ * -1 otherwise.
+ * 
+ * Complexity: O(n), where n is the number of elements in the queue.
+ * 
+ */
+int aqueue_reserve(AQueue *queue, int capacity);
+
+/*
+ * Description: Reduces the capacity of the array-backed queue
+ * specified by queue to the smallest power of two that holds its
+ * elements, releasing the storage entirely if the queue is empty.
+ * 
+ * Return Value: 0 if shrinking the storage is succesful, or
+ * -1 otherwise.
+ * 
+ * Complexity: O(n), where n is the number of elements in the queue.
+ * 
+ */
+int aqueue_shrink_to_fit(AQueue *queue);
+
+/*
+ * Description: Macro that evaluates to the data stored in the
+ * element at the head of the array-backed queue specified by queue.
+ * 
+ * Return Value: Data stored in the element at the head of the queue,
+ * or NULL if the queue is empty.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+#define aqueue_peek(queue) ((queue)->size == 0 ? NULL : \
+    (queue)->slots[(queue)->head])
+
+/*
+ * Description: Macro that evaluates to the number of elements in the
+ * array-backed queue specified by queue.
+ * 
+ * Return Value: Number of elements in the queue.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+#define aqueue_size(queue) ((queue)->size)
+
+/*
+ * Description: Macro that evaluates to the number of elements the
+ * array-backed queue specified by queue can hold without allocating.
+ * 
+ * Return Value: Capacity of the queue.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+#define aqueue_capacity(queue) ((queue)->capacity)
+
+#endif
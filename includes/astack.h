@@ -0,0 +1,140 @@
+/* Header for the Array-Backed Stack Abstract Datatype */
+
+#ifndef ASTACK_H
+#define ASTACK_H
+
+#include <stdlib.h>
+
+/* Implement array-backed stacks as vectors that double when full. */
+typedef struct AStack_
+{
+    int size;
+    int capacity;
+
+    void (*destroy)(void *data);
+
+    void **slots;
+} AStack;
+
+/* --------------------- Public Interface ------------------------ */
+
+/*
+ * Description: Initializes the array-backed stack specified by stack.
+ * This operation must be called for a stack before the stack can be
+ * used with any other operation. No storage is allocated until the
+ * first element is pushed or astack_reserve is called. The destroy
+ * argument works in a manner similar to that described for
+ * stack_init. For a stack containing data that should not be freed,
+ * destroy should be set to NULL.
+ * 
+ * Return Value: None.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+void astack_init(AStack *stack, void (*destroy)(void *data));
+
+/*
+ * Description: Destroys the array-backed stack specified by stack. No
+ * other operations are permitted after calling astack_destroy unless
+ * astack_init is called again. The astack_destroy operation removes
+ * all elements from a stack and calls the function passed as destroy
+ * to astack_init once for each element as it is removed, provided
+ * destroy was not set to NULL.
+ * 
+ * Return Value: None.
+ * 
+ * Complexity: O(n), where n is the number of elements in the stack.
+ * 
+ */
+void astack_destroy(AStack *stack);
+
+/*
+ * Description: Pushes an element onto the array-backed stack
+ * specified by stack. The capacity of the stack is doubled when it is
+ * full. The memory referenced by data should remain valid as long as
+ * the element remains in the stack.
+ * 
+ * Return Value: 0 if pushing the element is succesful, or -1
+ * otherwise.
+ * 
+ * Complexity: Amortized O(1)
+ * 
+ */
+int astack_push(AStack *stack, const void *data);
+
+/*
+ * Description: Pops an element off the array-backed stack specified
+ * by stack. Upon return, data points to the data stored in the
+ * element that was popped. The capacity of the stack is never
+ * reduced by this operation; see astack_shrink_to_fit.
+ * 
+ * Return Value: 0 if popping the element is succesful, or -1
+ * otherwise.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+int astack_pop(AStack *stack, void **data);
+
+/*
+ * Description: Ensures that the array-backed stack specified by stack
+ * can hold at least capacity elements without allocating again.
+ * 
+ * Return Value: 0 if reserving the storage is succesful, or -1
+ * otherwise.
+ * 
+ * Complexity: O(n), where n is the number of elements in the stack.
+ * 
+ */
+int astack_reserve(AStack *stack, int capacity);
+
+/*
+ * Description: Reduces the capacity of the array-backed stack
+ * specified by stack to its number of elements, releasing the
+ * storage entirely if the stack is empty.
+ * 
+ * Return Value: 0 if shrinking the storage is succesful, or -1
+ * otherwise.
+ * 
+ * Complexity: O(n), where n is the number of elements in the stack.
+ * 
+ */
+int astack_shrink_to_fit(AStack *stack);
+
+/*
+ * Description: Macro that evaluates to the data stored in the
+ * element at the top of the array-backed stack specified by stack.
+ * 
+ * Return Value: Data stored in the element at the top of the stack,
+ * or NULL if the stack is empty.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+#define astack_peek(stack) ((stack)->size == 0 ? \
+    NULL : (stack)->slots[(stack)->size - 1])
+
+/*
+ * Description: Macro that evaluates to the number of elements in the
+ * array-backed stack specified by stack.
+ * 
+ * Return Value: Number of elements in the stack.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+#define astack_size(stack) ((stack)->size)
+
+/*
+ * Description: Macro that evaluates to the number of elements the
+ * array-backed stack specified by stack can hold without allocating.
+ * 
+ * Return Value: Capacity of the stack.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+#define astack_capacity(stack) ((stack)->capacity)
+
+#endif
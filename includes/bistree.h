@@ -24,13 +24,52 @@ typedef struct AvlNode_ {
     void *data; /*!< The data stored in the node. */
     int hidden; /*!< A member used to mark a node when it is removed. */
     int factor; /*!< A node's balance factor. */
+    int count; /*!< The number of nodes not hidden in the subtree rooted at the node. */
 } AvlNode;
 
+/** 
+ * @brief A structure for the nodes of binary search trees, which hold the node of the binary tree
+ * and its AVL data in a single allocation. The data of the binary tree node points to the AVL data
+ * next to it, so code walking the binary tree sees the same layout as before.
+ */
+typedef struct BisTreeNode_ {
+    BiTreeNode node; /*!< The node of the binary tree, whose data points to avl. */
+    AvlNode avl; /*!< The AVL data of the node. */
+} BisTreeNode;
+
+/** 
+ * @brief A structure for the blocks of nodes of pooled binary search trees.
+ */
+typedef struct BisTreeChunk_ {
+    struct BisTreeChunk_ *next;
+    BisTreeNode nodes[];
+} BisTreeChunk;
+
+/**
+ * @brief Define the default number of nodes allocated at a time by pooled binary search trees.
+ */
+#define BISTREE_CHUNK_SIZE 64
+
 /** 
  * @brief Implement a binary search tree as binary trees. 
  */
 typedef BiTree BisTree;
 
+/**
+ * @brief Define the deepest path followed in a binary search tree. The height of an AVL tree of n
+ * nodes is less than 1.45 lg (n + 2), so this is enough for any number of nodes an int can count.
+ */
+#define BISTREE_MAX_HEIGHT 64
+
+/** 
+ * @brief A structure for cursors walking binary search trees in order, which hold the path from
+ * the root to the current node so that no storage is allocated.
+ */
+typedef struct BisTreeCursor_ {
+    BiTreeNode *path[BISTREE_MAX_HEIGHT]; /*!< The nodes from the root to the current node. */
+    int depth; /*!< The number of nodes on the path, or 0 once the cursor has run off the tree. */
+} BisTreeCursor;
+
 /**
  * 
  * @brief Initializes the binary search tree specified by tree.
@@ -54,6 +93,29 @@ typedef BiTree BisTree;
 void bistree_init(BisTree *tree, int (*compare)(const void *key1, const void *key2),
                   void (*destroy)(void *data));
 
+/**
+ * 
+ * @brief Initializes the binary search tree specified by tree, allocating its nodes in blocks.
+ * 
+ * The tree is used with the same operations as a tree initialized with #bistree_init, but its nodes
+ * are carved out of blocks of chunk_size nodes. Nodes released by the tree are kept for later
+ * insertions, and all blocks are freed at once by #bistree_destroy. This saves a call to malloc for
+ * most insertions and keeps nodes inserted together close in memory. A chunk_size less than 1 is
+ * treated as #BISTREE_CHUNK_SIZE. The compare and destroy arguments work as described for
+ * #bistree_init. The complexity is O(1).
+ * 
+ * @param[out] tree The tree to be initialized.
+ * @param[in] chunk_size The number of nodes allocated at a time.
+ * @param[in] compare A function pointer to compare element.
+ * @param[in] destroy A function pointer to be used by #bistree_destroy to free dynamically
+ * allocated data when #bistree_destroy is called.
+ * @return None.
+ * 
+ */
+void bistree_init_pooled(BisTree *tree, int chunk_size,
+                         int (*compare)(const void *key1, const void *key2),
+                         void (*destroy)(void *data));
+
 /**
  * @brief Destroys the binary search tree specified by tree. No other operations are permitted after
  * calling #bistree_destroy unless #bistree_init is called again. The #bistree_destroy operation
@@ -72,9 +134,9 @@ void bistree_destroy(BisTree *tree);
  * 
  * The new node contains a pointer to data, so the memory referenced by data should remain valid as
  * long as the node remains in the binary search tree. It is the responsibility of the caller to
- * manage the storage associated with data. The complexity is O(lg n), where n is the number of
- * nodes in the binary search tree. The complexity is O(lg n), where n is the number of nodes in the
- * binary search tree.
+ * manage the storage associated with data. The node of the binary tree and its AVL data are
+ * allocated together. The complexity is O(lg n), where n is the number of nodes in the binary
+ * search tree.
  * 
  * @param[out] tree The tree to insert the new node.
  * @param[in] data The data to be inserted in the tree.
@@ -91,7 +153,8 @@ int bistree_insert(BisTree *tree, const void *data);
  * hidden. Thus, no pointer is returned to the data matching data. The data in the tree must remain
  * valid even after it has been removed. Consequently, the size of the binary search tree, as
  * returned by #bistree_size, does not decrease after removing a node. This approach is explained
- * further in the implementation and analysis section. The complexity is O(lg n), where n is the
+ * further in the implementation and analysis section. Use #bistree_delete to free the node at once,
+ * or #bistree_compact to free hidden nodes in bulk. The complexity is O(lg n), where n is the
  * number of nodes in the binary search tree.
  * 
  * @param[out] tree The tree to remove the node.
@@ -101,6 +164,39 @@ int bistree_insert(BisTree *tree, const void *data);
  */
 int bistree_remove(BisTree *tree, const void *data);
 
+/**
+ * @brief Deletes the node matching data from the binary search tree specified by tree.
+ * 
+ * Unlike #bistree_remove, the node is unlinked from the tree and freed, and the tree is rebalanced,
+ * so the size of the tree decreases. Upon return, data points to the data stored in the node that
+ * was deleted. It is the responsibility of the caller to manage the storage associated with the
+ * data. A hidden node is not found, as with #bistree_lookup. The complexity is O(lg n), where n is
+ * the number of nodes in the binary search tree.
+ * 
+ * @param[in,out] tree The tree to delete the node.
+ * @param[in,out] data A pointer to the data to be deleted. Upon return, data points to the data
+ * stored in the node deleted.
+ * @return 0 if deleting the node is succesful, or -1 otherwise.
+ * 
+ */
+int bistree_delete(BisTree *tree, void **data);
+
+/**
+ * @brief Frees the nodes hidden by #bistree_remove from the binary search tree specified by tree,
+ * once they make up more than ratio of its nodes.
+ * 
+ * The data of the hidden nodes is passed to the destroy function given to #bistree_init, provided
+ * it was not set to NULL, and the nodes not hidden are rebuilt into a perfectly balanced tree, so
+ * the size of the tree decreases. A ratio of 0 frees the hidden nodes whenever there are any. The
+ * complexity is O(n), where n is the number of nodes in the binary search tree.
+ * 
+ * @param[in,out] tree The tree to compact.
+ * @param[in] ratio The fraction of the nodes that must be hidden for the tree to be compacted.
+ * @return 0 if compacting the tree is succesful or not needed, or -1 otherwise.
+ * 
+ */
+int bistree_compact(BisTree *tree, double ratio);
+
 /**
  * @brief Determines whether a node matches data in the binary search tree specified as tree. 
  * 
@@ -114,6 +210,106 @@ int bistree_remove(BisTree *tree, const void *data);
  */
 int bistree_lookup(BisTree *tree, void **data);
 
+/**
+ * @brief Finds the data of rank k among the nodes not hidden in the binary search tree specified
+ * by tree, that is, the data at position k in order.
+ * 
+ * Each node counts the nodes not hidden below it, so the search follows a single path. For the
+ * p-th percentile, k is p * (#bistree_visible(tree) - 1) / 100. The complexity is O(lg n), where n
+ * is the number of nodes in the binary search tree.
+ * 
+ * @param[in] tree The tree in which to select.
+ * @param[in] k The rank of the data to select, from 0 for the least to #bistree_visible(tree) - 1
+ * for the greatest.
+ * @param[out] data Upon return, data points to the data of rank k in the binary search tree.
+ * @return 0 if the data is found, or -1 if k is out of range.
+ * 
+ */
+int bistree_select(BisTree *tree, int k, void **data);
+
+/**
+ * @brief Determines the rank of data among the nodes not hidden in the binary search tree
+ * specified by tree, that is, the number of them that are less than data.
+ * 
+ * The data does not need to be in the tree. The complexity is O(lg n), where n is the number of
+ * nodes in the binary search tree.
+ * 
+ * @param[in] tree The tree in which to rank the data.
+ * @param[in] data The data to rank.
+ * @return The number of nodes not hidden whose data is less than data.
+ * 
+ */
+int bistree_rank(BisTree *tree, const void *data);
+
+/**
+ * @brief Positions cursor at the least data not less than data, among the nodes not hidden in the
+ * binary search tree specified by tree.
+ * 
+ * A data of NULL positions the cursor at the least data in the tree. The cursor stays valid until
+ * the tree is changed by any operation other than #bistree_lookup, #bistree_select or
+ * #bistree_rank. The complexity is O(lg n), where n is the number of nodes in the binary search
+ * tree, plus the number of hidden nodes passed over.
+ * 
+ * @param[in] tree The tree in which to seek.
+ * @param[out] cursor The cursor to position.
+ * @param[in] data The data to seek, or NULL.
+ * @return 0 if the cursor is positioned at a node, or -1 if all the data in the tree is less than
+ * data.
+ * 
+ */
+int bistree_seek(BisTree *tree, BisTreeCursor *cursor, const void *data);
+
+/**
+ * @brief Moves cursor to the next node not hidden in order.
+ * 
+ * The complexity is O(1) amortized over a walk of the tree, plus the number of hidden nodes passed
+ * over.
+ * 
+ * @param[in,out] cursor The cursor to move, positioned by #bistree_seek.
+ * @return 0 if the cursor is positioned at a node, or -1 if it has run off the end of the tree.
+ * 
+ */
+int bistree_next(BisTreeCursor *cursor);
+
+/**
+ * @brief Moves cursor to the previous node not hidden in order, as #bistree_next does forward.
+ * 
+ * @param[in,out] cursor The cursor to move, positioned by #bistree_seek.
+ * @return 0 if the cursor is positioned at a node, or -1 if it has run off the start of the tree.
+ * 
+ */
+int bistree_prev(BisTreeCursor *cursor);
+
+/**
+ * @brief Calls callback in order with the data of each node not hidden from lo to hi, inclusive,
+ * in the binary search tree specified by tree.
+ * 
+ * A lo or hi of NULL leaves the range open at that end. No storage is allocated. The callback must
+ * not change the tree. The complexity is O(lg n + m), where n is the number of nodes in the binary
+ * search tree and m the number of nodes in the range.
+ * 
+ * @param[in] tree The tree to scan.
+ * @param[in] lo The least data of the range, or NULL.
+ * @param[in] hi The greatest data of the range, or NULL.
+ * @param[in] callback A function pointer called with the data of each node in the range and ctx.
+ * Returning a value other than 0 stops the scan.
+ * @param[in] ctx A pointer passed to callback.
+ * @return 0 once the range has been scanned, or the value returned by callback if it stopped the scan.
+ * 
+ */
+int bistree_range(BisTree *tree, const void *lo, const void *hi,
+                  int (*callback)(const void *data, void *ctx), void *ctx);
+
+/**
+ * @brief Macro that evaluates to the data at the node where cursor is positioned. The complexity is
+ * O(1).
+ * 
+ * @param[in] cursor The cursor, positioned by #bistree_seek.
+ * @return Data stored in the node.
+ * 
+ */
+#define bistree_cursor_data(cursor) (((AvlNode *)(cursor)->path[(cursor)->depth - 1]->data)->data)
+
 /**
  * @brief Macro that evaluates to the number of nodes in the binary search tree specified by tree.
  * The complexity is O(1).
@@ -124,4 +320,14 @@ int bistree_lookup(BisTree *tree, void **data);
  */
 #define bistree_size(tree) ((tree)->size)
 
+/**
+ * @brief Macro that evaluates to the number of nodes not hidden in the binary search tree
+ * specified by tree. The complexity is O(1).
+ * 
+ * @param[in] tree The tree to evaluate.
+ * @return Number of nodes not hidden in the tree.
+ * 
+ */
+#define bistree_visible(tree) ((tree)->root == NULL ? 0 : ((AvlNode *)(tree)->root->data)->count)
+
 #endif
\ No newline at end of file
@@ -31,6 +31,13 @@ typedef struct BiTree_
     void (*destroy)(void *data); /*!< The encapsulated destroy function passed to #bitree_init. */
 
     BiTreeNode *root; /*!< Pointer to the top of the node hierarchy. */
+
+    int chunk_size; /*!< Member not used by binary trees but by binary search trees: the number of
+    nodes allocated at a time, or 0 to allocate nodes one by one. */
+    void *free_nodes; /*!< Member not used by binary trees but by binary search trees: the nodes
+    allocated and not in use. */
+    void *chunks; /*!< Member not used by binary trees but by binary search trees: the blocks of
+    nodes allocated at a time. */
 } BiTree;
 
 /* ------------------------------------- Public Interface --------------------------------------- */
@@ -0,0 +1,229 @@
+/**
+ * @file bptree.h
+ * @date 16 October 2026
+ * @brief Header for the B+-Tree Abstract Datatype.
+ */
+
+#ifndef BPTREE_H
+#define BPTREE_H
+
+/**
+ * @brief Define the most keys held by a node of a B+-tree. With 8-byte pointers, an inner node
+ * then fills eight 64-byte cache lines, and a leaf a little over four, so a search touches a few
+ * lines per level instead of one node per key compared. Every node but the root holds at least
+ * half as many keys. The order must be even.
+ */
+#define BPTREE_ORDER 30
+
+/**
+ * @brief A structure for the part common to the nodes of B+-trees.
+ */
+typedef struct BPTreeNode_ {
+    int leaf; /*!< 1 if the node is a leaf, or 0 if it is an inner node. */
+    int count; /*!< The number of keys in the node. */
+    void *keys[BPTREE_ORDER]; /*!< The data of a leaf, or the least data of each later child. */
+} BPTreeNode;
+
+/**
+ * @brief A structure for the leaves of B+-trees, which hold the data in order and are linked for
+ * scanning.
+ */
+typedef struct BPTreeLeaf_ {
+    BPTreeNode node;
+    struct BPTreeLeaf_ *prev; /*!< The leaf holding the data just before, or NULL. */
+    struct BPTreeLeaf_ *next; /*!< The leaf holding the data just after, or NULL. */
+} BPTreeLeaf;
+
+/**
+ * @brief A structure for the inner nodes of B+-trees, which have one more child than keys.
+ */
+typedef struct BPTreeInner_ {
+    BPTreeNode node;
+    BPTreeNode *children[BPTREE_ORDER + 1];
+} BPTreeInner;
+
+/**
+ * @brief A structure for B+-trees.
+ *
+ * All the data is kept in order in the leaves, which are all at the same depth, and inner nodes
+ * only steer searches, each key being the least data of the subtree to its right. Nodes are
+ * searched by bisection.
+ */
+typedef struct BPTree_ {
+    int size;
+    int (*compare)(const void *key1, const void *key2);
+    void (*destroy)(void *data);
+    BPTreeNode *root;
+    BPTreeLeaf *first; /*!< The leaf holding the least data, or NULL if the tree is empty. */
+    BPTreeLeaf *last; /*!< The leaf holding the greatest data, or NULL if the tree is empty. */
+} BPTree;
+
+/**
+ * @brief A structure for cursors walking B+-trees in order.
+ */
+typedef struct BPTreeCursor_ {
+    BPTreeLeaf *leaf; /*!< The leaf of the current data, or NULL once off the tree. */
+    int position; /*!< The position of the current data in the leaf. */
+} BPTreeCursor;
+
+/* ------------------------------------- Public Interface --------------------------------------- */
+
+/**
+ * @brief Initializes the B+-tree specified by tree.
+ *
+ * This operation must be called for a B+-tree before the tree can be used with any other
+ * operation. The compare and destroy arguments work as for #bistree_init. No storage is allocated
+ * until the first data is inserted. The complexity is O(1).
+ *
+ * @param[out] tree The tree to be initialized.
+ * @param[in] compare A function pointer to compare elements. This function should return 1 if key1
+ * > key2, 0 if key1 = key2, and -1 if key1 < key2.
+ * @param[in] destroy A function pointer to be used by #bptree_destroy to free dynamically
+ * allocated data, or NULL.
+ * @return None.
+ *
+ */
+void bptree_init(BPTree *tree, int (*compare)(const void *key1, const void *key2),
+                 void (*destroy)(void *data));
+
+/**
+ * @brief Destroys the B+-tree specified by tree.
+ *
+ * No other operations are permitted after calling #bptree_destroy unless #bptree_init is called
+ * again. The destroy function passed to #bptree_init is called once for each data, provided it was
+ * not set to NULL. The complexity is O(n), where n is the number of data in the tree.
+ *
+ * @param[in] tree The tree to be destroyed.
+ * @return None.
+ *
+ */
+void bptree_destroy(BPTree *tree);
+
+/**
+ * @brief Inserts data into the B+-tree specified by tree.
+ *
+ * The new data is not inserted if it matches data already in the tree. A full node is split in
+ * two, which may split its parent in turn. The memory referenced by data should remain valid as
+ * long as the data remains in the tree. The complexity is O(lg n), where n is the number of data in
+ * the tree.
+ *
+ * @param[in,out] tree The tree to insert the data.
+ * @param[in] data The data to be inserted.
+ * @return 0 if inserting the data is succesful, 1 if the data is already in the tree, or -1
+ * otherwise.
+ *
+ */
+int bptree_insert(BPTree *tree, const void *data);
+
+/**
+ * @brief Removes the data matching data from the B+-tree specified by tree.
+ *
+ * A node left with too few keys takes one from a sibling or is merged with it. Upon return, data
+ * points to the data that was removed, and it is the responsibility of the caller to manage its
+ * storage. The complexity is O(lg n), where n is the number of data in the tree.
+ *
+ * @param[in,out] tree The tree to remove the data.
+ * @param[in,out] data A pointer to the data to be removed. Upon return, data points to the data
+ * removed from the tree.
+ * @return 0 if removing the data is succesful, or -1 otherwise.
+ *
+ */
+int bptree_remove(BPTree *tree, void **data);
+
+/**
+ * @brief Determines whether data matches data in the B+-tree specified by tree.
+ *
+ * The complexity is O(lg n), where n is the number of data in the tree.
+ *
+ * @param[in] tree The tree to search.
+ * @param[in,out] data A pointer to the data to be searched. Upon return, data points to the
+ * matching data in the tree.
+ * @return 0 if the data is found in the tree, or -1 otherwise.
+ *
+ */
+int bptree_lookup(const BPTree *tree, void **data);
+
+/**
+ * @brief Loads the B+-tree specified by tree, which must be empty, with the array of size data in
+ * data, sorted in strictly ascending order.
+ *
+ * The tree is built bottom up, with its leaves and inner nodes as full as they can be made, and no
+ * comparisons other than those checking the order. The memory referenced by each data should
+ * remain valid as long as the data remains in the tree. The complexity is O(n), where n is size.
+ *
+ * @param[in,out] tree The tree to load.
+ * @param[in] data The data to be loaded.
+ * @param[in] size The number of data.
+ * @return 0 if loading the tree is succesful, or -1 if the tree is not empty, the data is not in
+ * order, or storage cannot be allocated.
+ *
+ */
+int bptree_load(BPTree *tree, void **data, int size);
+
+/**
+ * @brief Positions cursor at the least data not less than data in the B+-tree specified by tree.
+ *
+ * A data of NULL positions the cursor at the least data in the tree. The cursor stays valid until
+ * the tree is changed. The complexity is O(lg n), where n is the number of data in the tree.
+ *
+ * @param[in] tree The tree in which to seek.
+ * @param[out] cursor The cursor to position.
+ * @param[in] data The data to seek, or NULL.
+ * @return 0 if the cursor is positioned at data, or -1 if all the data in the tree is less than
+ * data.
+ *
+ */
+int bptree_seek(const BPTree *tree, BPTreeCursor *cursor, const void *data);
+
+/**
+ * @brief Moves cursor to the next data in order. The complexity is O(1).
+ *
+ * @param[in,out] cursor The cursor to move, positioned by #bptree_seek.
+ * @return 0 if the cursor is positioned at data, or -1 if it has run off the end of the tree.
+ *
+ */
+int bptree_next(BPTreeCursor *cursor);
+
+/**
+ * @brief Moves cursor to the previous data in order. The complexity is O(1).
+ *
+ * @param[in,out] cursor The cursor to move, positioned by #bptree_seek.
+ * @return 0 if the cursor is positioned at data, or -1 if it has run off the start of the tree.
+ *
+ */
+int bptree_prev(BPTreeCursor *cursor);
+
+/**
+ * @brief Calls callback in order with each data from lo to hi, inclusive, in the B+-tree specified
+ * by tree.
+ *
+ * A lo or hi of NULL leaves the range open at that end. The scan follows the links between leaves,
+ * and no storage is allocated. The callback must not change the tree. The complexity is
+ * O(lg n + m), where n is the number of data in the tree and m the number of data in the range.
+ *
+ * @param[in] tree The tree to scan.
+ * @param[in] lo The least data of the range, or NULL.
+ * @param[in] hi The greatest data of the range, or NULL.
+ * @param[in] callback A function pointer called with each data in the range and ctx. Returning a
+ * value other than 0 stops the scan.
+ * @param[in] ctx A pointer passed to callback.
+ * @return 0 once the range has been scanned, or the value returned by callback if it stopped the
+ * scan.
+ *
+ */
+int bptree_range(const BPTree *tree, const void *lo, const void *hi,
+                 int (*callback)(const void *data, void *ctx), void *ctx);
+
+/**
+ * @brief Macro that evaluates to the data at which cursor is positioned.
+ *
+ */
+#define bptree_cursor_data(cursor) ((cursor)->leaf->node.keys[(cursor)->position])
+
+/**
+ * @brief Macro that evaluates to the number of data in the B+-tree specified by tree.
+ *
+ */
+#define bptree_size(tree) ((tree)->size)
+
+#endif
@@ -12,6 +12,17 @@
 
 #include "list.h"
 
+/**
+ * @brief Default maximum load factor of a chained hash table before it grows.
+ */
+#define CHTBL_MAX_LOAD 1.0
+
+/**
+ * @brief Number of buckets migrated from the old table by each insertion or removal while a
+ * chained hash table is being rehashed.
+ */
+#define CHTBL_REHASH_STEP 4
+
 /**
  * @brief A structure for chained hash tables
  */
@@ -26,6 +37,14 @@ typedef struct CHTbl_ {
 
     int size; /*!<  The number of elements currently in the table */
     List *table; /*!< The array of buckets */
+
+    double max_load; /*!< The load factor above which the table grows, or 0 for a fixed number of
+    buckets */
+    int min_buckets; /*!< The number of buckets passed to #chtbl_init, below which the table never
+    shrinks */
+    List *old_table; /*!< The array of buckets being migrated into table, or NULL */
+    int old_buckets; /*!< Number of buckets in old_table */
+    int migrated; /*!< Number of buckets of old_table already migrated into table */
 } CHTbl;
 
 /* ------------------------------------- Public Interface --------------------------------------- */
@@ -43,7 +62,9 @@ typedef struct CHTbl_ {
  * hash table is destroyed. For structured data containing several dynamically allocated members,
  * #destroy should be set to a user-defined function that calls free for each dynamically allocated
  * member as well as for the structure itself. For a hash table containing data tha should not be
- * freed, #destroy should be set to NULL.
+ * freed, #destroy should be set to NULL. The hash table grows when its load factor exceeds
+ * #CHTBL_MAX_LOAD and shrinks back towards buckets as elements are removed; see
+ * #chtbl_set_max_load.
  * 
  * @param[in,out] htbl Chained hash table to be initialized
  * @param[in] buckets Number of buckets allocated in the hash table
@@ -113,6 +134,22 @@ int chtbl_remove(CHTbl *htbl, void **data);
  */
 int chtbl_lookup(const CHTbl *htbl, void **data);
 
+/**
+ * @brief Sets the maximum load factor of the chained hash table specified by htbl.
+ * 
+ * When an insertion makes the number of elements exceed max_load times the number of buckets, the
+ * number of buckets is doubled. When removals make it fall below a quarter of that, the number of
+ * buckets is halved, but never below the number passed to #chtbl_init. Elements are migrated into
+ * the new array of buckets incrementally, #CHTBL_REHASH_STEP buckets per insertion or removal, so no
+ * single operation rehashes the whole table. A max_load of 0 keeps the number of buckets fixed.
+ * 
+ * @param[in,out] htbl Chained hash table to configure.
+ * @param[in] max_load The maximum load factor, or 0 to disable resizing.
+ * @return None.
+ * 
+ */
+void chtbl_set_max_load(CHTbl *htbl, double max_load);
+
 /**
  * @brief Macro that evaluates to the number of elements in the chained hash table specified by 
  * htbl.
@@ -0,0 +1,39 @@
+/**
+ * @file extsort.h
+ * @date 16 October 2026
+ * @brief Header for the External Merge Sort.
+ */
+
+#ifndef EXTSORT_H
+#define EXTSORT_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+/**
+ * @brief Uses external merge sort to sort the fixed-size records read from in, writing them to out.
+ * Complexity: O(n lg n) comparisons, where n is the number of records, and O(n p) record transfers,
+ * where p is the number of passes over the data.
+ *
+ * The records are read from in up to memory bytes at a time, and each chunk is sorted with qksort.
+ * When everything fits in a single chunk, it is written straight to out. Otherwise each chunk is
+ * written to a temporary file as a sorted run, and the runs are merged into out by a heap of
+ * cursors, with memory shared evenly between the read buffers of the runs and the write buffer. If
+ * there are more runs than fanin, groups of fanin runs are first merged into longer runs, as many
+ * times as needed. Records that compare equal keep the order of their runs, but the order within a
+ * run is that of qksort, which is not stable. The number of records is not limited by an int.
+ *
+ * @param[in] in The stream to read the records from, positioned at the first record.
+ * @param[out] out The stream to write the sorted records to. It is not flushed or closed.
+ * @param[in] esize The size of each record.
+ * @param[in] memory The number of bytes of memory to use for buffers.
+ * @param[in] fanin The largest number of runs to merge at a time, or 0 to derive it from memory so
+ * that each run gets a read buffer of at least 64 KB. Values less than 2 are treated as 2.
+ * @param[in] compare Specifies a user-defined function to compare records, as for qksort.
+ * @return Returns 0 if sorting is successful, or –1 if memory is too small to hold three records,
+ * storage cannot be allocated, or reading or writing a file fails.
+ */
+int extsort(FILE *in, FILE *out, int esize, size_t memory, int fanin,
+            int (*compare)(const void *key1, const void *key2));
+
+#endif
@@ -18,6 +18,8 @@ typedef struct Heap_ {
     void (*destroy)(void *data);
 
     void **tree;
+    int capacity; /*!< The number of nodes tree can hold before it must be reallocated. */
+    int arity; /*!< The number of children of each node. */
 } Heap;
 
 /* ------------------------------------- Public Interface --------------------------------------- */
@@ -46,6 +48,27 @@ typedef struct Heap_ {
 void heap_init(Heap *heap, int (*compare)(const void *key1, const void *key2), 
                void (*destroy)(void *data));
 
+/**
+ * @brief Initializes the heap specified by heap as a d-ary heap, in which each node has arity
+ * children instead of two.
+ * 
+ * The heap is used with the same operations as a heap initialized with #heap_init, whose arity is
+ * 2. A larger arity makes the tree shallower, and the children of a node are adjacent in the tree,
+ * so for large heaps an arity of 4 or 8 touches fewer cache lines per insertion and extraction at
+ * the cost of more comparisons per level. An arity less than 2 is treated as 2. The compare and
+ * destroy arguments work as described for #heap_init. The complexity is O(1).
+ * 
+ * @param[in,out] heap The heap to be initialized.
+ * @param[in] arity The number of children of each node.
+ * @param[in] compare The compare function used to compare the nodes when fixing the heap.
+ * @param[in] destroy The destroy function is used to deallocated each user member specified in 
+ * data.
+ * @return None.
+ * 
+ */
+void heap_init_arity(Heap *heap, int arity, int (*compare)(const void *key1, const void *key2),
+                     void (*destroy)(void *data));
+
 /**
  * @brief Destroys the heap specified by heap.
  * 
@@ -65,8 +88,8 @@ void heap_destroy(Heap *heap);
  * 
  * The new node contains a pointer to data, so the memory referenced by data should remain valid as
  * long as the node remains in the heap. It is the responsibility of the caller to manage the 
- * storage associated with data. The complexity is O(log(n)), where n is the number of nodes in the
- * heap.
+ * storage associated with data. The storage used by the heap doubles when it is full, so the
+ * complexity is amortized O(log(n)), where n is the number of nodes in the heap.
  * 
  * @param[in] heap The heap to insert the new node.
  * @param[in] data The data to be inserted in the new node.
@@ -79,8 +102,9 @@ int heap_insert(Heap *heap, const void *data);
  * @brief Extracts the node at the top of the heap specified by heap.
  * 
  * Upon return, data points to the data stored in the node that was extracted. It is the 
- * responsibility of the caller to manage the storage associated with the data. The complexity is
- * O(log(n)), where n is the number of nodes in the heap.
+ * responsibility of the caller to manage the storage associated with the data. The storage used by
+ * the heap is halved when it falls to a quarter full. The complexity is O(log(n)), where n is the
+ * number of nodes in the heap.
  * 
  * @param[in] heap The heap to extract the node.
  * @param[in] data The data to be extracted. Upon return, data points to the data stored in the node
@@ -90,6 +114,49 @@ int heap_insert(Heap *heap, const void *data);
  */
 int heap_extract(Heap *heap, void **data);
 
+/**
+ * @brief Builds the heap specified by heap from the array of size nodes specified by data.
+ * 
+ * The heap adopts data as its storage instead of copying it, so data must have been allocated with
+ * malloc, must not be freed by the caller, and is reordered in place. Any nodes previously in the
+ * heap are discarded without calling destroy, so the heap should be empty. Building the heap
+ * bottom-up has a complexity of O(n), where n is the number of nodes, compared with O(n lg n) for n
+ * calls to #heap_insert.
+ * 
+ * @param[in] heap The heap to be built.
+ * @param[in] data An array of pointers to the data of each node, allocated with malloc.
+ * @param[in] size The number of nodes in data.
+ * @return 0 if building the heap is succesful, or -1 otherwise.
+ * 
+ */
+int heap_build(Heap *heap, void **data, int size);
+
+/**
+ * @brief Ensures that the heap specified by heap can hold at least capacity nodes without
+ * reallocating its storage.
+ * 
+ * This avoids the reallocations of a heap whose maximum number of nodes is known in advance. The
+ * complexity is O(n), where n is the number of nodes in the heap.
+ * 
+ * @param[in] heap The heap to reserve storage for.
+ * @param[in] capacity The number of nodes the heap should hold.
+ * @return 0 if reserving the storage is succesful, or -1 otherwise.
+ * 
+ */
+int heap_reserve(Heap *heap, int capacity);
+
+/**
+ * @brief Reduces the storage used by the heap specified by heap to its number of nodes.
+ * 
+ * The storage is released entirely if the heap is empty. The complexity is O(n), where n is the
+ * number of nodes in the heap.
+ * 
+ * @param[in] heap The heap to shrink.
+ * @return 0 if shrinking the storage is succesful, or -1 otherwise.
+ * 
+ */
+int heap_shrink_to_fit(Heap *heap);
+
 /**
  * @brief Macro that evaluates to the number of nodes in the heap specified by heap.
  * 
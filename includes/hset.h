@@ -0,0 +1,163 @@
+/* Header for the Hashed Set Abstract Datatype */
+
+#ifndef HSET_H
+#define HSET_H
+
+#include <stdio.h>
+#include "chtbl.h"
+
+/* Implement hashed sets as chained hash tables */
+typedef CHTbl HSet;
+
+/* --------------------- Public Interface ------------------------ */
+
+/*
+ * Description: Initializes the hashed set specified by set. This
+ * operation must be called for a set before the set can be used with
+ * any other operation. The number of buckets allocated for the hash
+ * index is specified by buckets, and h is a user-defined function for
+ * hashing members, as described for chtbl_init. The match and destroy
+ * arguments work in a manner similar to that described for set_init.
+ * 
+ * Return Value: 0 if initializing the set is succesful, or -1
+ * otherwise.
+ * 
+ * Complexity: O(m), where m is the number of buckets.
+ * 
+ */
+#define hset_init chtbl_init
+
+/*
+ * Description: Destroys the hashed set specified by set. No other
+ * operations are permitted after calling hset_destroy unless
+ * hset_init is called again. The hset_destroy operation removes all
+ * members from a set and calls the function passed as destroy to
+ * hset_init once for each member as it is removed, provided destroy
+ * was not set to NULL.
+ * 
+ * Return Value: None.
+ * 
+ * Complexity: O(m + n), where m is the number of buckets and n is the
+ * number of members in the set.
+ * 
+ */
+#define hset_destroy chtbl_destroy
+
+/*
+ * Description: Inserts a member into the hashed set specified by set.
+ * The new member contains a pointer to data, so the memory referenced
+ * by data should remain valid as long as the member remains in the
+ * set. It is the responsibility of the caller to manage the storage
+ * with data.
+ * 
+ * Return Value: 0 if inserting the member is succesful, 1 if the
+ * member is already in the set, or -1 otherwise.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+#define hset_insert chtbl_insert
+
+/*
+ * Description: Removes the member matching data from the hashed set
+ * specified by set. Upon return, data points to the data stored in
+ * the member that was removed. It is the responsibility of the caller
+ * to manage the storage associated with the data.
+ *
+ * Return Value: 0 if removing the member is succesful, or 
+ * -1 otherwise.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+#define hset_remove chtbl_remove
+
+/*
+ * Description: Builds a hashed set that is the union of set1 and
+ * set2. Upon return, setu contains the union and uses the hash and
+ * match functions of set1. Because setu points to data in set1 and
+ * set2, the data in set1 and set2 must remain valid until setu is
+ * destroyed with hset_destroy.
+ *
+ * Return Value: 0 if computing the union is succesful, or 
+ * -1 otherwise.
+ * 
+ * Complexity: O(m + n), where m and n are the number of members in
+ * set1 and set2, respectively.
+ * 
+ */
+int hset_union(HSet *setu, const HSet *set1, const HSet *set2);
+
+/*
+ * Description: Builds a hashed set that is the intersection of set1
+ * and set2. Upon return, seti contains the intersection. Because seti
+ * points to data in set1, the data in set1 must remain valid until
+ * seti is destroyed with hset_destroy.
+ *
+ * Return Value: 0 if computing the intersection is succesful, or -1
+ * otherwise.
+ * 
+ * Complexity: O(m), where m is the number of members in set1.
+ * 
+ */
+int hset_intersection(HSet *seti, const HSet *set1, const HSet *set2);
+
+/*
+ * Description: Builds a hashed set that is the difference of set1 and
+ * set2. Upon return, setd contains the difference. Because setd
+ * points to data in set1, the data in set1 must remain valid until
+ * setd is destroyed with hset_destroy.
+ *
+ * Return Value: 0 if computing the difference is succesful, or -1
+ * otherwise.
+ * 
+ * Complexity: O(m), where m is the number of members in set1.
+ * 
+ */
+int hset_difference(HSet *setd, const HSet *set1, const HSet *set2);
+
+/*
+ * Description: Determines whether the data specified by data matches
+ * that of a member in the hashed set specified by set.
+ *
+ * Return Value: 1 if the member is found, or 0 otherwise.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+int hset_is_member(const HSet *set, const void *data);
+
+/*
+ * Description: Determines whether the hashed set specified by set1 is
+ * a subset of the hashed set specified by set2.
+ *
+ * Return Value: 1 if the set is a subset, or 0 otherwise.
+ * 
+ * Complexity: O(m), where m is the number of members in set1.
+ * 
+ */
+int hset_is_subset(const HSet *set1, const HSet *set2);
+
+/*
+ * Description: Determines whether the hashed set specified by set1 is
+ * equal to the hashed set specified by set2.
+ *
+ * Return Value: 1 if the two sets are equal, or 0 otherwise.
+ * 
+ * Complexity: O(m), where m is the number of members in set1.
+ * 
+ */
+int hset_is_equal(const HSet *set1, const HSet *set2);
+
+/*
+ * Description: Macro that evaluates to the number of members in the
+ * hashed set specified by set.
+ *
+ * Return Value: Number of members in the set.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+#define hset_size chtbl_size
+
+#endif
@@ -0,0 +1,183 @@
+/**
+ * @file iheap.h
+ * @date 16 October 2026
+ * @brief Header for the Indexed Heap Abstract Datatype.
+ */
+
+#ifndef IHEAP_H
+#define IHEAP_H
+
+/**
+ * @brief Define a structure for indexed heaps.
+ * 
+ * Each node inserted into an indexed heap is identified by a handle, a small integer that stays
+ * valid while the node remains in the heap, no matter how the node moves within the tree. The heap
+ * keeps the position of each handle in the tree, so a node can be reprioritized or removed given its
+ * handle.
+ */
+typedef struct IHeap_ {
+    int size;
+    int (*compare)(const void *key1, const void *key2);
+    void (*destroy)(void *data);
+
+    int *tree; /*!< The handle of each node in the tree, followed by the free handles. */
+    void **data; /*!< The data of each handle. */
+    int *position; /*!< The position in the tree of each handle, or -1 for a free handle. */
+    int handles; /*!< The number of handles issued so far. */
+    int capacity; /*!< The number of handles the arrays can hold before they must be reallocated. */
+} IHeap;
+
+/* ------------------------------------- Public Interface --------------------------------------- */
+
+/**
+ * @brief Initializes the indexed heap specified by heap.
+ * 
+ * This operation must be called for an indexed heap before the heap can be used with any other
+ * operation. The compare and destroy arguments work as described for #heap_init. The complexity is
+ * O(1).
+ * 
+ * @param[in,out] heap The indexed heap to be initialized.
+ * @param[in] compare The compare function used to compare the nodes when fixing the heap.
+ * @param[in] destroy The destroy function is used to deallocated each user member specified in 
+ * data.
+ * @return None.
+ * 
+ */
+void iheap_init(IHeap *heap, int (*compare)(const void *key1, const void *key2),
+                void (*destroy)(void *data));
+
+/**
+ * @brief Destroys the indexed heap specified by heap.
+ * 
+ * No other operations are permitted after calling #iheap_destroy unless #iheap_init is called
+ * again. The #iheap_destroy operation removes all nodes from a heap and calls the function passed
+ * as destroy to #iheap_init once for each node as it is removed, provided destroy was not set to
+ * NULL. The complexity is O(n), where n is the number of nodes in the heap.
+ * 
+ * @param[in] heap The indexed heap to be destroyed.
+ * @return None.
+ * 
+ */
+void iheap_destroy(IHeap *heap);
+
+/**
+ * @brief Inserts a node into the indexed heap specified by heap.
+ * 
+ * The new node contains a pointer to data, so the memory referenced by data should remain valid as
+ * long as the node remains in the heap. Upon return, handle identifies the new node until it is
+ * extracted or removed, after which the handle may be reused for another node. The complexity is
+ * amortized O(lg n), where n is the number of nodes in the heap.
+ * 
+ * @param[in] heap The indexed heap to insert the new node.
+ * @param[in] data The data to be inserted in the new node.
+ * @param[out] handle The handle of the new node. May be NULL if the handle is not needed.
+ * @return 0 if inserting the node is succesful, or -1 otherwise.
+ * 
+ */
+int iheap_insert(IHeap *heap, const void *data, int *handle);
+
+/**
+ * @brief Extracts the node at the top of the indexed heap specified by heap.
+ * 
+ * Upon return, data points to the data stored in the node that was extracted, and the handle of the
+ * node is released. The complexity is O(lg n), where n is the number of nodes in the heap.
+ * 
+ * @param[in] heap The indexed heap to extract the node.
+ * @param[out] data Upon return, data points to the data stored in the node extracted.
+ * @return 0 if extracting the node is succesful, or -1 otherwise.
+ * 
+ */
+int iheap_extract(IHeap *heap, void **data);
+
+/**
+ * @brief Removes the node identified by handle from the indexed heap specified by heap.
+ * 
+ * Upon return, data points to the data stored in the node that was removed, and the handle is
+ * released. The complexity is O(lg n), where n is the number of nodes in the heap.
+ * 
+ * @param[in] heap The indexed heap to remove the node.
+ * @param[in] handle The handle of the node to be removed.
+ * @param[out] data Upon return, data points to the data stored in the node removed.
+ * @return 0 if removing the node is succesful, or -1 if handle does not identify a node.
+ * 
+ */
+int iheap_remove(IHeap *heap, int handle, void **data);
+
+/**
+ * @brief Replaces the data of the node identified by handle in the indexed heap specified by heap,
+ * and moves the node up or down to restore the heap property.
+ * 
+ * The data may be the same pointer as before if its key was changed in place. It is the
+ * responsibility of the caller to manage the storage associated with the previous data. The
+ * complexity is O(lg n), where n is the number of nodes in the heap.
+ * 
+ * @param[in] heap The indexed heap containing the node.
+ * @param[in] handle The handle of the node to be updated.
+ * @param[in] data The new data of the node.
+ * @return 0 if updating the node is succesful, or -1 if handle does not identify a node.
+ * 
+ */
+int iheap_update(IHeap *heap, int handle, const void *data);
+
+/**
+ * @brief Gives the node identified by handle a key closer to the top of the heap. This is the
+ * decrease-key operation of a heap whose top is its smallest key.
+ * 
+ * @param[in] heap The indexed heap containing the node.
+ * @param[in] handle The handle of the node to be updated.
+ * @param[in] data The new data of the node.
+ * @return 0 if updating the node is succesful, or -1 otherwise.
+ * 
+ */
+#define iheap_increase_key iheap_update
+
+/**
+ * @brief Gives the node identified by handle a key farther from the top of the heap. This is the
+ * increase-key operation of a heap whose top is its smallest key.
+ * 
+ * @param[in] heap The indexed heap containing the node.
+ * @param[in] handle The handle of the node to be updated.
+ * @param[in] data The new data of the node.
+ * @return 0 if updating the node is succesful, or -1 otherwise.
+ * 
+ */
+#define iheap_decrease_key iheap_update
+
+/**
+ * @brief Macro that evaluates to the data at the top of the indexed heap specified by heap.
+ * 
+ * @param[in] heap The indexed heap.
+ * @return Data at the top of the heap, or NULL if the heap is empty.
+ */
+#define iheap_peek(heap) ((heap)->size == 0 ? NULL : (heap)->data[(heap)->tree[0]])
+
+/**
+ * @brief Macro that determines whether handle identifies a node in the indexed heap specified by
+ * heap.
+ * 
+ * @param[in] heap The indexed heap.
+ * @param[in] handle The handle to be checked.
+ * @return 1 if the handle identifies a node, or 0 otherwise.
+ */
+#define iheap_is_member(heap, handle) ((handle) >= 0 && (handle) < (heap)->handles && \
+    (heap)->position[(handle)] >= 0)
+
+/**
+ * @brief Macro that evaluates to the data of the node identified by handle in the indexed heap
+ * specified by heap.
+ * 
+ * @param[in] heap The indexed heap.
+ * @param[in] handle The handle of a node in the heap.
+ * @return Data of the node.
+ */
+#define iheap_data(heap, handle) ((heap)->data[(handle)])
+
+/**
+ * @brief Macro that evaluates to the number of nodes in the indexed heap specified by heap.
+ * 
+ * @param[in] heap The indexed heap to evaluate the size.
+ * @return Number of nodes in the heap.
+ */
+#define iheap_size(heap) ((heap)->size)
+
+#endif
@@ -0,0 +1,139 @@
+/**
+ * @file kll.h
+ * @date 16 October 2026
+ * @brief Header for the KLL Quantile Sketch Abstract Datatype.
+ */
+
+#ifndef KLL_H
+#define KLL_H
+
+#include <stdint.h>
+
+/**
+ * @brief Define a structure for KLL quantile sketches.
+ * 
+ * A sketch keeps a bounded sample of the values inserted, in levels. Each value at level h stands
+ * for 2 to the power h of the values inserted. When the sketch is full, the lowest level over its
+ * capacity is compacted: it is sorted, and every other value, starting at random from the first or
+ * second, moves to the level above while the rest are discarded. Capacities shrink by a factor of
+ * 2/3 from the top level, whose capacity is k, down to the bottom one, so the sketch holds O(k)
+ * values however many are inserted, and the error in the rank of a value shrinks in proportion to
+ * 1 / k.
+ */
+typedef struct KLL_ {
+    long long size; /*!< The number of values inserted, including those merged from other sketches. */
+    int k;
+
+    int levels;
+    int max_levels; /*!< The number of levels the arrays can hold before they must be reallocated. */
+    double **items; /*!< The values kept at each level. */
+    int *counts; /*!< The number of values kept at each level. */
+    int *capacities; /*!< The number of values each array of items can hold before it must grow. */
+    int kept; /*!< The number of values kept over all levels. */
+    int max_kept; /*!< The number of values kept over all levels beyond which the sketch is compacted. */
+
+    double min;
+    double max;
+
+    uint64_t state; /*!< The state of the generator choosing which values are kept. */
+} KLL;
+
+/* ------------------------------------- Public Interface --------------------------------------- */
+
+/**
+ * @brief Initializes the KLL sketch specified by kll.
+ * 
+ * This operation must be called for a sketch before the sketch can be used with any other
+ * operation. A larger k gives more accurate quantiles for more memory; with 200, the sketch keeps
+ * about 600 values, and quantiles are typically off by less than half a percent in rank. A k less
+ * than 8 is treated as 8. The complexity is O(1).
+ * 
+ * @param[in,out] kll The sketch to be initialized.
+ * @param[in] k The capacity of the top level of the sketch.
+ * @return Returns 0 if initializing the sketch is successful, or -1 otherwise.
+ * 
+ */
+int kll_init(KLL *kll, int k);
+
+/**
+ * @brief Destroys the KLL sketch specified by kll.
+ * 
+ * No other operations are permitted after calling #kll_destroy unless #kll_init is called again.
+ * The complexity is O(l), where l is the number of levels.
+ * 
+ * @param[in] kll The sketch to be destroyed.
+ * @return None.
+ * 
+ */
+void kll_destroy(KLL *kll);
+
+/**
+ * @brief Inserts a value into the KLL sketch specified by kll.
+ * 
+ * The complexity is amortized O(lg k), the cost of sorting levels when they are compacted.
+ * 
+ * @param[in] kll The sketch.
+ * @param[in] value The value to be inserted. It should not be NaN.
+ * @return Returns 0 if inserting the value is successful, or -1 otherwise.
+ * 
+ */
+int kll_insert(KLL *kll, double value);
+
+/**
+ * @brief Merges the KLL sketch specified by other into the sketch specified by kll.
+ * 
+ * Upon return, kll summarizes the values inserted into both sketches, with the accuracy of the k
+ * given to kll. Sketches built on different threads or hosts can thus be combined. The sketch
+ * other is unchanged. The complexity is O(m lg m), where m is the number of values kept by both
+ * sketches.
+ * 
+ * @param[in] kll The sketch receiving the values.
+ * @param[in] other The sketch to be merged.
+ * @return Returns 0 if merging the sketches is successful, or -1 otherwise.
+ * 
+ */
+int kll_merge(KLL *kll, const KLL *other);
+
+/**
+ * @brief Estimates the value at the quantile q of the values inserted into the KLL sketch
+ * specified by kll.
+ * 
+ * The quantiles 0 and 1 are the exact least and greatest values inserted. The complexity is
+ * O(m lg m), where m is the number of values kept by the sketch.
+ * 
+ * @param[in] kll The sketch.
+ * @param[in] q The quantile, from 0 to 1; 0.5 is the median.
+ * @param[out] value Upon return, the value estimated at the quantile.
+ * @return Returns 0 if estimating the quantile is successful, or -1 if the sketch is empty, q is
+ * out of range, or storage cannot be allocated.
+ * 
+ */
+int kll_quantile(const KLL *kll, double q, double *value);
+
+/**
+ * @brief Estimates the fraction of the values inserted into the KLL sketch specified by kll that
+ * are less than or equal to value.
+ * 
+ * The complexity is O(m), where m is the number of values kept by the sketch.
+ * 
+ * @param[in] kll The sketch.
+ * @param[in] value The value to be ranked.
+ * @return The fraction estimated, from 0 to 1, or 0 if the sketch is empty.
+ * 
+ */
+double kll_rank(const KLL *kll, double value);
+
+/**
+ * @brief Macro that evaluates to the number of values inserted into the KLL sketch specified by
+ * kll.
+ * 
+ */
+#define kll_size(kll) ((kll)->size)
+
+/**
+ * @brief Macro that evaluates to the number of values kept by the KLL sketch specified by kll.
+ * 
+ */
+#define kll_kept(kll) ((kll)->kept)
+
+#endif
@@ -14,6 +14,18 @@ typedef struct ListElmt_
    struct ListElmt_ *next;
 } ListElmt;
 
+/* Define a structure for the chunks of elements in pooled lists. */
+
+typedef struct ListChunk_
+{
+   struct ListChunk_ *next;
+   ListElmt elmts[];
+} ListChunk;
+
+/* Define the default number of elements carved out of each chunk. */
+
+#define LIST_CHUNK_SIZE 64
+
 /* Define a structure for linked lists. */
 
 typedef struct List_
@@ -25,6 +37,10 @@ typedef struct List_
 
    ListElmt *head;
    ListElmt *tail;
+
+   int chunk_size;
+   ListElmt *free_elmts;
+   ListChunk *chunks;
    
 } List;
 
@@ -51,6 +67,24 @@ typedef struct List_
  */
 void list_init(List *list, void (*destroy)(void *data));
 
+/*
+ * Description: Initializes the linked list specified by list as a
+ * pooled list. A pooled list behaves exactly as a list initialized
+ * with list_init, except that its elements are carved out of chunks
+ * of chunk_size elements instead of being allocated one by one.
+ * Removed elements are kept in a free list and reused by later
+ * insertions, and all chunks are released at once by list_destroy.
+ * If chunk_size is not greater than 0, LIST_CHUNK_SIZE is used. The
+ * destroy argument works as described for list_init.
+ *
+ * Return Value: None.
+ *
+ * Complexity: O(1)
+ *
+ */
+void list_init_pooled(List *list, int chunk_size,
+   void (*destroy)(void *data));
+
 /*
  * Description: Destroys the linked list specified by list. No other
  * operations are permitted after calling list_destroy unless 
@@ -29,6 +29,8 @@ typedef struct OHTbl_ {
 
     int size;
     void **table;
+    int *probes; /*!< For tables initialized with #ohtbl_init_robin_hood, the distance of each
+    occupied position from the position its element hashes to, or NULL for double hashing. */
 } OHTbl;
 
 /* ------------------------------------- Public Interface --------------------------------------- */
@@ -58,6 +60,30 @@ typedef struct OHTbl_ {
 int ohtbl_init(OHTbl *htbl, int positions, int (*h1)(const void *key), int (*h2)(const void *key), 
                int (*match)(const void *key1, const void *key2), void (*destroy)(void *data));
 
+/**
+ * @brief Initializes the open-addressed hash table specified by htbl to use Robin Hood hashing.
+ * 
+ * The table uses linear probing from the position given by the user-defined hash function h, and
+ * an element being inserted takes the position of any element that is closer to its own hashed
+ * position, which keeps the variance of probe lengths low. A lookup stops as soon as it reaches an
+ * element closer to its hashed position than the key would be, so misses terminate early. Removals
+ * shift the following elements back instead of leaving vacated positions, so lookups do not slow
+ * down as elements are inserted and removed over time. The match and destroy arguments work as
+ * described for #ohtbl_init, and the table is used with the same operations. The complexity is
+ * O(m), where m is the number of positions in the hash table.
+ * 
+ * @param[in,out] htbl The open-addressed hash table to be initialized.
+ * @param[in] positions The number of positions to be allocated in the hash table.
+ * @param[in] h User-defined hash function.
+ * @param[in] match User-defined function to determine if two keys match.
+ * @param[in] destroy Provides a way to free dynamically allocated data when #ohtbl_destroy is 
+ * called.
+ * @return 0 if initializing the hash table is succesful, or -1 otherwise.
+ */
+int ohtbl_init_robin_hood(OHTbl *htbl, int positions, int (*h)(const void *key),
+                          int (*match)(const void *key1, const void *key2),
+                          void (*destroy)(void *data));
+
 /**
  * @brief Destroys the open-addressed hash table specified by htbl.
  * 
@@ -43,6 +43,21 @@ typedef Heap PQueue;
  */
 #define pqueue_init heap_init
 
+/*
+ * @brief Initializes the priority queue specified by pqueue as a d-ary heap whose nodes have arity
+ * children. This works as described for #heap_init_arity; an arity of 4 or 8 reduces cache misses
+ * for large priority queues.
+ * 
+ * @param[in,out] pqueue The priority queue to be initialized.
+ * @param[in] arity The number of children of each node.
+ * @param[in] compare The compare function used to compare the elements when fixing the pqueue.
+ * @param[in] destroy The destroy function is used to deallocated each user member specified in 
+ * data.
+ * @return None.
+ * 
+ */
+#define pqueue_init_arity heap_init_arity
+
 /*
  * @brief Destroys the priority queue specified by pqueue.
  * 
@@ -96,7 +111,28 @@ typedef Heap PQueue;
  * The complexity is O(1).
  * 
  */
-#define pqueue_peek(pqueue) ((pqueue)->tree == NULL ? NULL : (pqueue)->tree[0])
+#define pqueue_peek(pqueue) ((pqueue)->size == 0 ? NULL : (pqueue)->tree[0])
+
+/**
+ * @brief Ensures that the priority queue specified by pqueue can hold at least capacity elements
+ * without reallocating its storage.
+ * 
+ * @param[in] pqueue The priority queue to reserve storage for.
+ * @param[in] capacity The number of elements the priority queue should hold.
+ * @return 0 if reserving the storage is succesful, or -1 otherwise.
+ * 
+ */
+#define pqueue_reserve heap_reserve
+
+/**
+ * @brief Reduces the storage used by the priority queue specified by pqueue to its number of
+ * elements.
+ * 
+ * @param[in] pqueue The priority queue to shrink.
+ * @return 0 if shrinking the storage is succesful, or -1 otherwise.
+ * 
+ */
+#define pqueue_shrink_to_fit heap_shrink_to_fit
 
 /**
  * @brief Macro that evaluates to the number of elements in the priority queue specified by queue.
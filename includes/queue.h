@@ -27,6 +27,19 @@ typedef List Queue;
  */
 #define queue_init list_init
 
+/*
+ * Description: Initializes the queue specified by queue as a pooled
+ * queue, whose elements are carved out of chunks of chunk_size
+ * elements as described for list_init_pooled. This avoids one call
+ * to malloc and free for each element that is enqueued and dequeued.
+ * 
+ * Return Value: None.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+#define queue_init_pooled list_init_pooled
+
 /*
  * Description: Destroys the queue specified by queue. No other
  * operations are permitted after calling queue_destroy unless
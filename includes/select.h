@@ -0,0 +1,36 @@
+/**
+ * @file select.h
+ * @date 16 October 2026
+ * @brief Header for Selection Algorithms.
+ */
+
+#ifndef SELECT_H
+#define SELECT_H
+
+/**
+ * @brief Uses introselect to find the element of rank k in the array of elements in data, that is,
+ * the element at position k once data is sorted.
+ * Complexity: O(n), where n is the number of elements in data. Partitions are split three ways
+ * around the median of three elements, or the ninther for large partitions, as in qksort; when
+ * that fails to narrow the search after twice lg n partitions, the partition value becomes the
+ * median of medians of groups of five, which bounds the worst case to O(n) as well.
+ *
+ * @param[in/out] data The data in which to select. When select_kth returns, the element of rank k is
+ * at position k, the elements before it are less than or equal to it, and the elements after it are
+ * greater than or equal to it.
+ * @param[in] size The number of elements in data.
+ * @param[in] esize The size of each element.
+ * @param[in] k The rank of the element to select, from 0 for the least to size - 1 for the greatest.
+ * For the p-th percentile, k is p * (size - 1) / 100.
+ * @param[in] compare Specifies a user-defined function to compare elements. This function should
+ * return 1 if key1 > key2, 0 if key1 = key2, and –1 if key1 < key2.
+ * @return Returns 0 if selecting is successful, or –1 otherwise.
+ */
+int select_kth(void *data, int size, int esize, int k, int (*compare)(const void *key1, const void *key2));
+
+/**
+ * @brief Same as select_kth, for an array of int compared directly.
+ */
+int select_kth_int(int *data, int size, int k);
+
+#endif
@@ -0,0 +1,142 @@
+/**
+ * @file smedian.h
+ * @date 16 October 2026
+ * @brief Header for the Streaming Median Abstract Datatype.
+ */
+
+#ifndef SMEDIAN_H
+#define SMEDIAN_H
+
+#include "iheap.h"
+
+/**
+ * @brief Define a structure for the samples held by a streaming median.
+ * 
+ */
+typedef struct SMedianEntry_ {
+    void *data;
+    struct SMedian_ *owner; /*!< The streaming median holding the sample, used to compare samples. */
+    int side; /*!< 0 if the sample is in the lower heap, or 1 if it is in the upper heap. */
+    int handle; /*!< The handle of the sample in its heap. */
+} SMedianEntry;
+
+/**
+ * @brief Define a structure for streaming medians.
+ * 
+ * The samples at or below the tracked quantile are kept in a heap whose top is the greatest of
+ * them, and the samples above it in a heap whose top is the least of them. Each insertion moves at
+ * most one sample between the heaps to keep the lower heap at the size the quantile requires, so
+ * the quantile is always the top of the lower heap.
+ */
+typedef struct SMedian_ {
+    int size;
+    double quantile;
+    int window; /*!< The number of most recent samples tracked, or 0 to track all of them. */
+
+    int (*compare)(const void *key1, const void *key2);
+    void (*destroy)(void *data);
+
+    IHeap lower;
+    IHeap upper;
+
+    SMedianEntry *ring; /*!< The samples of a sliding window, in the order they were inserted. */
+    int oldest; /*!< The position in ring of the oldest sample. */
+} SMedian;
+
+/* ------------------------------------- Public Interface --------------------------------------- */
+
+/**
+ * @brief Initializes the streaming median specified by median.
+ * 
+ * This operation must be called for a streaming median before it can be used with any other
+ * operation. The quantile is the rank tracked among the samples, as a fraction: 0.5 tracks the
+ * median, and 0.9 or 0.99 track the 90th and 99th percentiles. Among n samples, the sample tracked
+ * is the one at position quantile * (n - 1), rounded down, once the samples are sorted; for an even
+ * number of samples, the median is thus the lower of the two middle samples. When window is
+ * greater than 0, only the most recent window samples are tracked, and inserting a sample into a
+ * full window expires the oldest one. The compare argument is a function used to compare samples.
+ * It should return 1 if key1 > key2, 0 if key1 = key2, and -1 if key1 < key2. The destroy argument
+ * provides a way to free dynamically allocated data when a sample is expired by #smedian_insert or
+ * when #smedian_destroy is called. For samples that should not be freed, destroy should be set to
+ * NULL. The complexity is O(w), where w is the size of the window.
+ * 
+ * @param[in,out] median The streaming median to be initialized.
+ * @param[in] quantile The quantile tracked, from 0 to 1.
+ * @param[in] window The number of most recent samples tracked, or 0 to track all samples.
+ * @param[in] compare The compare function used to compare samples.
+ * @param[in] destroy The destroy function is used to deallocate each sample.
+ * @return Returns 0 if initializing the streaming median is successful, or -1 otherwise.
+ * 
+ */
+int smedian_init(SMedian *median, double quantile, int window,
+                 int (*compare)(const void *key1, const void *key2), void (*destroy)(void *data));
+
+/**
+ * @brief Destroys the streaming median specified by median.
+ * 
+ * No other operations are permitted after calling #smedian_destroy unless #smedian_init is called
+ * again. The #smedian_destroy operation removes all samples and calls the function passed as
+ * destroy to #smedian_init once for each sample as it is removed, provided destroy was not set to
+ * NULL. The complexity is O(n), where n is the number of samples.
+ * 
+ * @param[in] median The streaming median to be destroyed.
+ * @return None.
+ * 
+ */
+void smedian_destroy(SMedian *median);
+
+/**
+ * @brief Inserts a sample into the streaming median specified by median.
+ * 
+ * The memory referenced by data should remain valid as long as the sample is tracked. When the
+ * window is full, the oldest sample is expired first, and passed to the destroy function given to
+ * #smedian_init, provided it was not set to NULL. The complexity is O(lg n), where n is the number
+ * of samples.
+ * 
+ * @param[in] median The streaming median.
+ * @param[in] data The sample to be inserted.
+ * @return Returns 0 if inserting the sample is successful, or -1 otherwise.
+ * 
+ */
+int smedian_insert(SMedian *median, const void *data);
+
+/**
+ * @brief Expires the oldest sample of the sliding window of the streaming median specified by
+ * median, without inserting a new one.
+ * 
+ * This allows samples to be expired by age rather than by count. Upon return, data points to the
+ * sample expired. It is the responsibility of the caller to manage the storage associated with the
+ * data. The complexity is O(lg n), where n is the number of samples.
+ * 
+ * @param[in] median The streaming median.
+ * @param[out] data Upon return, data points to the sample expired.
+ * @return Returns 0 if expiring the sample is successful, or -1 if the window is empty or the
+ * streaming median has no window.
+ * 
+ */
+int smedian_expire(SMedian *median, void **data);
+
+/**
+ * @brief Macro that evaluates to the oldest sample in the sliding window of the streaming median
+ * specified by median, or NULL if the window is empty or the streaming median has no window.
+ * 
+ */
+#define smedian_oldest(median) ((median)->window == 0 || (median)->size == 0 ? NULL : \
+    (median)->ring[(median)->oldest].data)
+
+/**
+ * @brief Macro that evaluates to the sample at the quantile tracked by the streaming median
+ * specified by median, or NULL if it has no samples. The complexity is O(1).
+ * 
+ */
+#define smedian_peek(median) ((median)->size == 0 ? NULL : \
+    ((SMedianEntry *)iheap_peek(&(median)->lower))->data)
+
+/**
+ * @brief Macro that evaluates to the number of samples tracked by the streaming median specified
+ * by median.
+ * 
+ */
+#define smedian_size(median) ((median)->size)
+
+#endif
@@ -9,6 +9,8 @@
 #ifndef SORT_H
 #define SORT_H
 
+#include <stdint.h>
+
 /**
  * @brief Uses insertion sort to sort the array of elements in data.
  * Complexity: O(n ** 2), where n is the number of elements to be sorted.
@@ -26,7 +28,12 @@ int issort(void *data, int size, int esize, int (*compare)(const void *key1, con
 
 /**
  * @brief Uses quicksort to sort the array of elements in data.
- * Complexity: O(n lg n), where n is the number of elements to be sorted.
+ * Complexity: O(n lg n), where n is the number of elements to be sorted. The sort is an introsort:
+ * the partition value is the median of three elements, or the ninther for large partitions,
+ * partitions are split three ways so runs of equal elements are not sorted again, partitions of up
+ * to 16 elements are finished with insertion sort, and partitioning that goes deeper than twice
+ * lg n falls back to heapsort, so the worst case is also O(n lg n). No storage is allocated unless
+ * esize is larger than 128 bytes.
  *
  * @param[in/out] data The data to be sorted. When qksort returns, data contains the sorted elements.
  * @param[in] size The number of elements in data.
@@ -43,7 +50,8 @@ int qksort(void *data, int size, int esize, int i, int k, int (*compare)(const v
 
 /**
  * @brief Uses merge sort to sort the array of elements in data.
- * Complexity: O(n lg n), where n is the number of elements to be sorted.
+ * Complexity: O(n lg n), where n is the number of elements to be sorted. The sort is stable, and
+ * a single buffer of k - i + 1 elements is allocated for all merges.
  *
  * @param[in] data The data to be sorted. When mgsort returns, data contains the sorted elements.
  * @param[in] size The number of elements in data.
@@ -59,6 +67,61 @@ int qksort(void *data, int size, int esize, int i, int k, int (*compare)(const v
  */
 int mgsort(void *data, int size, int esize, int i, int k, int (*compare)(const void *key1, const void *key2));
 
+/**
+ * @brief Uses a natural merge sort in the style of TimSort to sort the array of elements in data.
+ * Complexity: O(n lg n) in the worst case, and O(n) for data that is already sorted or reversed,
+ * where n is the number of elements to be sorted.
+ *
+ * The sort is stable. It finds the ascending and strictly descending runs already present in data,
+ * reversing the descending ones, and extends short runs to between 32 and 64 elements with binary
+ * insertion sort. Runs are merged in a balanced order using galloping, so blocks of elements that
+ * do not interleave are moved at once and nearly sorted data takes near-linear time. A single
+ * buffer of size / 2 elements is allocated for all merges.
+ *
+ * @param[in/out] data The data to be sorted. When tmsort returns, data contains the sorted elements.
+ * @param[in] size The number of elements in data.
+ * @param[in] esize The size of each element.
+ * @param[in] compare Specifies a user-defined function to compare elements. This function should return 1 if
+ * key1 > key2, 0 if key1 = key2, and –1 if key1 < key2 for an ascending sort.
+ * For a descending sort, compare should reverse the cases returning 1 and –1. When tmsort returns, data contains
+ * the sorted elements.
+ * @return Returns 0 if sorting is successful, or –1 otherwise.
+ */
+int tmsort(void *data, int size, int esize, int (*compare)(const void *key1, const void *key2));
+
+/**
+ * @brief Uses quicksort on several threads to sort the array of elements in data.
+ * Complexity: O(n lg n), where n is the number of elements to be sorted, shared between the
+ * threads. Partitions larger than 8192 elements are split three ways around the ninther, and one
+ * part is handed to a work-stealing thread pool (see tpool.h) while the thread keeps splitting the
+ * other; smaller partitions, and partitions that go deeper than twice lg n, are sorted with qksort.
+ * The sort is not stable.
+ *
+ * @param[in/out] data The data to be sorted. When psort returns, data contains the sorted elements.
+ * @param[in] size The number of elements in data.
+ * @param[in] esize The size of each element.
+ * @param[in] compare Specifies a user-defined function to compare elements, as for qksort. It is called
+ * from several threads at once.
+ * @param[in] nthreads The number of threads to use, or 0 to use one thread for each processor online.
+ * @return Returns 0 if sorting is successful, or –1 otherwise.
+ */
+int psort(void *data, int size, int esize, int (*compare)(const void *key1, const void *key2), int nthreads);
+
+/**
+ * @brief Uses heapsort to sort the array of elements in data.
+ * Complexity: O(n lg n) in the worst case, where n is the number of elements to be sorted. Elements
+ * are exchanged in place, so no storage is allocated.
+ *
+ * @param[in/out] data The data to be sorted. When hpsort returns, data contains the sorted elements.
+ * @param[in] size The number of elements in data.
+ * @param[in] esize The size of each element.
+ * @param[in] compare Specifies a user-defined function to compare elements. This function should return 1 if
+ * key1 > key2, 0 if key1 = key2, and –1 if key1 < key2 for an ascending sort.
+ * For a descending sort, compare should reverse the cases returning 1 and –1. When hpsort returns, data contains
+ * the sorted elements.
+ * @return Returns 0 if sorting is successful, or –1 otherwise.
+ */
+int hpsort(void *data, int size, int esize, int (*compare)(const void *key1, const void *key2));
 
 /**
  * @brief Uses couting sort to sort the array of int elements in data.
@@ -77,13 +140,107 @@ int ctsort(int * data, int size, int k);
 /*
  * @brief Uses radix sort to sort the array of int elements in data.
  * Complexity: O(pn + pk), where n is the number of integers to be sorted, k is the radix, and p is
- * the number of digit positions.
+ * the number of digit positions. The integers must not be negative.
  *
  * @param[in] data The data to be sorted. When rxsort returns, data contains the sorted integers.
  * @param[in] size The number of elements in data.
  * @param[in] p The number of digital positions in each integer.
  * @param[in] k The radix to be used.
+ * @return Returns 0 if sorting is successful, or –1 otherwise.
  */
 int rxsort(int *data, int size, int p, int k);
 
+/**
+ * @brief Uses radix sort to sort the array of unsigned 32-bit integers in data.
+ * Complexity: O(n), where n is the number of integers to be sorted. The integers are sorted one
+ * byte at a time from the least significant, the counts for every byte are gathered in a single
+ * pass over the data, and a byte shared by all the integers is not sorted at all.
+ *
+ * @param[in/out] data The data to be sorted. When rxsort_u32 returns, data contains the sorted integers.
+ * @param[in] size The number of elements in data.
+ * @return Returns 0 if sorting is successful, or –1 otherwise.
+ */
+int rxsort_u32(uint32_t *data, int size);
+
+/**
+ * @brief Same as rxsort_u32, for signed 32-bit integers.
+ */
+int rxsort_i32(int32_t *data, int size);
+
+/**
+ * @brief Same as rxsort_u32, for unsigned 64-bit integers.
+ */
+int rxsort_u64(uint64_t *data, int size);
+
+/**
+ * @brief Same as rxsort_u32, for signed 64-bit integers.
+ */
+int rxsort_i64(int64_t *data, int size);
+
+/**
+ * @brief Same as rxsort_u32, for floats. Negative zero sorts before positive zero, and NaNs sort
+ * at either end depending on their sign bit.
+ */
+int rxsort_f32(float *data, int size);
+
+/**
+ * @brief Same as rxsort_f32, for doubles.
+ */
+int rxsort_f64(double *data, int size);
+
+/**
+ * @brief Uses radix sort to sort the array of records in data by an unsigned 64-bit key.
+ * Complexity: O(n), where n is the number of elements to be sorted. The key of each record is
+ * extracted once and sorted together with the position of its record, then the records are moved
+ * into place, so the sort is stable.
+ *
+ * @param[in/out] data The data to be sorted. When rxsort_keyed returns, data contains the sorted elements.
+ * @param[in] size The number of elements in data.
+ * @param[in] esize The size of each element.
+ * @param[in] key Specifies a user-defined function returning the key of a record. For a signed key,
+ * flip its sign bit to have negative keys sort first.
+ * @return Returns 0 if sorting is successful, or –1 otherwise.
+ */
+int rxsort_keyed(void *data, int size, int esize, uint64_t (*key)(const void *data));
+
+/**
+ * @brief Uses radix sort on several threads to sort the array of unsigned 32-bit integers in data.
+ * Complexity: O(n/t), where n is the number of integers to be sorted and t the number of threads.
+ * Each thread counts the digits of its own block of the data, works out from all the counts where
+ * its elements go, and moves them there a cache line at a time. Data too small to share between
+ * threads is sorted with rxsort_u32 on the calling thread.
+ *
+ * @param[in/out] data The data to be sorted. When prxsort_u32 returns, data contains the sorted integers.
+ * @param[in] size The number of elements in data.
+ * @param[in] nthreads The number of threads to use, including the calling thread, or 0 to use one
+ * thread for each processor online.
+ * @return Returns 0 if sorting is successful, or –1 otherwise.
+ */
+int prxsort_u32(uint32_t *data, int size, int nthreads);
+
+/**
+ * @brief Same as prxsort_u32, for signed 32-bit integers.
+ */
+int prxsort_i32(int32_t *data, int size, int nthreads);
+
+/**
+ * @brief Same as prxsort_u32, for unsigned 64-bit integers.
+ */
+int prxsort_u64(uint64_t *data, int size, int nthreads);
+
+/**
+ * @brief Same as prxsort_u32, for signed 64-bit integers.
+ */
+int prxsort_i64(int64_t *data, int size, int nthreads);
+
+/**
+ * @brief Same as prxsort_u32, for floats, in the order of rxsort_f32.
+ */
+int prxsort_f32(float *data, int size, int nthreads);
+
+/**
+ * @brief Same as prxsort_u32, for doubles, in the order of rxsort_f64.
+ */
+int prxsort_f64(double *data, int size, int nthreads);
+
 #endif
@@ -32,6 +32,19 @@ typedef List Stack;
  */
 #define stack_init list_init
 
+/*
+ * Description: Initializes the stack specified by stack as a pooled
+ * stack, whose elements are carved out of chunks of chunk_size
+ * elements as described for list_init_pooled. This avoids one call
+ * to malloc and free for each element that is pushed and popped.
+ * 
+ * Return Value: None.
+ * 
+ * Complexity: O(1)
+ * 
+ */
+#define stack_init_pooled list_init_pooled
+
 /*
  * Description: Destroys the stack specified by stack. No other 
  * operations are permitted after calling stack_destroy unless
@@ -0,0 +1,132 @@
+/**
+ * @file swtbl.h
+ * @date 16 October 2026
+ * @brief Header for the Group-Probed Hash Table Abstract Datatype
+ */
+
+#ifndef SWTBL_H
+#define SWTBL_H
+
+#include <stdlib.h>
+
+/**
+ * @brief Number of positions probed at a time. Each group of positions shares one 16-byte vector of
+ * control bytes.
+ */
+#define SWTBL_GROUP 16
+
+/**
+ * @brief A structure for group-probed hash tables.
+ * 
+ * Next to the array of elements, the table keeps one control byte per position. A control byte is
+ * negative for an empty or deleted position, and otherwise holds 7 bits of the hash of the element
+ * stored in that position, so the user-defined match function is only called for positions whose
+ * bits agree with those of the key.
+ */
+typedef struct SwTbl_ {
+    int positions; /*!< The number of positions allocated in the hash table, a power of two that is
+    a multiple of #SWTBL_GROUP. */
+
+    int (*h)(const void *key); /*!< User-defined hash function used in #swtbl_init. */
+    int (*match)(const void *key1, const void *key2); /*!< User-defined function to determine if two
+    keys match in #swtbl_init. */
+    void (*destroy)(void *data); /*!< User-defined function to provide a way to free dynamically
+    allocated data when #swtbl_destroy is called. */
+
+    int size; /*!< The number of elements in the hash table. */
+    int deleted; /*!< The number of positions marked as deleted. */
+    signed char *ctrl; /*!< The control byte of each position. */
+    void **table; /*!< The element stored in each position. */
+} SwTbl;
+
+/* ------------------------------------- Public Interface --------------------------------------- */
+
+/**
+ * @brief Initializes the group-probed hash table specified by htbl.
+ * 
+ * This operation must be called for a group-probed hash table before the hash table can be used
+ * with any other operation. The number of positions initially allocated is positions, rounded up to
+ * a power of two that is a multiple of #SWTBL_GROUP. The table grows automatically when it is 7/8
+ * full. The function pointer h specifies a user-defined hash function, whose value is mixed before
+ * use, so it need not spread keys across all bits. The match and destroy arguments work as
+ * described for #ohtbl_init. The complexity is O(m), where m is the number of positions.
+ * 
+ * @param[in,out] htbl The group-probed hash table to be initialized.
+ * @param[in] positions The number of positions to be allocated in the hash table.
+ * @param[in] h User-defined hash function.
+ * @param[in] match User-defined function to determine if two keys match.
+ * @param[in] destroy Provides a way to free dynamically allocated data when #swtbl_destroy is
+ * called.
+ * @return 0 if initializing the hash table is succesful, or -1 otherwise.
+ */
+int swtbl_init(SwTbl *htbl, int positions, int (*h)(const void *key),
+               int (*match)(const void *key1, const void *key2), void (*destroy)(void *data));
+
+/**
+ * @brief Destroys the group-probed hash table specified by htbl.
+ * 
+ * No other operations are permitted after calling #swtbl_destroy unless #swtbl_init is called
+ * again. The #swtbl_destroy operation removes all elements from a hash table and calls the function
+ * passed as destroy to #swtbl_init once for each element as it is removed, provided destroy was not
+ * set to NULL. The complexity is O(m), where m is the number of positions in the hash table.
+ * 
+ * @param[in] htbl The group-probed hash table to be destroyed.
+ * @return None.
+ * 
+ */
+void swtbl_destroy(SwTbl *htbl);
+
+/**
+ * @brief Inserts an element into the group-probed hash table specified by htbl.
+ * 
+ * The new element contains a pointer to data, so the memory referenced by data should remain valid
+ * as long as the element remains in the hash table. It is the responsibility of the caller to
+ * manage the storage associated with data. The complexity is O(1) amortized.
+ * 
+ * @param[in,out] htbl The group-probed hash table to insert the element.
+ * @param[in] data A pointer to the data to be inserted in htbl.
+ * @return 0 if inserting the element is succesful, 1 if the element is already in the hash table,
+ * or -1 otherwise.
+ * 
+ */
+int swtbl_insert(SwTbl *htbl, const void *data);
+
+/**
+ * @brief Removes the element matching data from the group-probed hash table specified by htbl.
+ * 
+ * Upon return, data points to the data stored in the element that was removed. It is the
+ * responsibility of the caller to manage the storage associated with the data. The complexity is
+ * O(1).
+ * 
+ * @param[in,out] htbl The group-probed hash table to delete the element.
+ * @param[in,out] data A pointer to the data to be removed. Upon return, data points to the data
+ * stored in the element that was removed.
+ * @return 0 if removing the element is succesful, or -1 otherwise.
+ * 
+ */
+int swtbl_remove(SwTbl *htbl, void **data);
+
+/**
+ * @brief Determines whether an element matches data in the group-probed hash table specified by
+ * htbl.
+ * 
+ * If a match is found, upon return data points to the matching data in the hash table. The
+ * complexity is O(1).
+ * 
+ * @param[in] htbl The group-probed hash table to lookup the element.
+ * @param[in,out] data A pointer to the element to be found.
+ * @return 0 if the element is found in the hash table, or -1 otherwise.
+ * 
+ */
+int swtbl_lookup(const SwTbl *htbl, void **data);
+
+/**
+ * @brief Macro that evaluates to the number of elements in the group-probed hash table specified
+ * by htbl. The complexity is O(1).
+ * 
+ * @return Number of elements in the hash table.
+ * 
+ */
+#define swtbl_size(htbl) ((htbl)->size)
+
+#endif
@@ -0,0 +1,142 @@
+/**
+ * @file tpool.h
+ * @date 16 October 2026
+ * @brief Header for the Work-Stealing Thread Pool.
+ */
+
+#ifndef TPOOL_H
+#define TPOOL_H
+
+#include <pthread.h>
+
+/**
+ * @brief Define a structure for the tasks run by a thread pool.
+ * 
+ */
+typedef struct TPoolTask_ {
+    void (*run)(void *arg);
+    void *arg;
+} TPoolTask;
+
+/**
+ * @brief Define a structure for the double-ended queues of tasks held by a thread pool.
+ * 
+ */
+typedef struct TPoolDeque_ {
+    TPoolTask *tasks; /*!< Circular buffer of tasks, whose capacity is a power of two. */
+    int capacity;
+    int head; /*!< The position of the oldest task, which is the one stolen by other workers. */
+    int size;
+
+    pthread_mutex_t lock;
+} TPoolDeque;
+
+/**
+ * @brief Define a structure for the workers of a thread pool.
+ * 
+ */
+typedef struct TPoolWorker_ {
+    struct TPool_ *pool;
+    int id;
+
+    pthread_t thread;
+} TPoolWorker;
+
+/**
+ * @brief Define a structure for thread pools.
+ * 
+ */
+typedef struct TPool_ {
+    int nworkers;
+
+    TPoolWorker *workers;
+    TPoolDeque *deques; /*!< One deque for each worker, then one for tasks submitted by other threads. */
+
+    int queued; /*!< The number of tasks waiting in the deques. */
+    int pending; /*!< The number of tasks submitted and not yet finished. */
+    int stop;
+
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+} TPool;
+
+/* ------------------------------------- Public Interface --------------------------------------- */
+
+/**
+ * @brief Initializes the thread pool specified by pool, starting its workers.
+ * 
+ * This operation must be called for a thread pool before the pool can be used with any other
+ * operation. Each worker has a deque of its own: tasks submitted by a worker are added to its
+ * deque, and the worker runs the newest task in its deque first. A worker whose deque is empty
+ * steals the oldest task from the deque of another worker, or from the deque of tasks submitted by
+ * other threads. Workers without tasks sleep until a task is submitted. The complexity is O(w),
+ * where w is the number of workers.
+ * 
+ * @param[in,out] pool The thread pool to be initialized.
+ * @param[in] nworkers The number of workers, or 0 for one worker for each processor online.
+ * @return Returns 0 if initializing the thread pool is successful, or -1 otherwise.
+ * 
+ */
+int tpool_init(TPool *pool, int nworkers);
+
+/**
+ * @brief Destroys the thread pool specified by pool.
+ * 
+ * No other operations are permitted after calling #tpool_destroy unless #tpool_init is called
+ * again. The #tpool_destroy operation waits for all tasks submitted to finish, then stops the
+ * workers. It must not be called by a worker of the pool. The complexity is O(w), where w is the
+ * number of workers, once the tasks have finished.
+ * 
+ * @param[in] pool The thread pool to be destroyed.
+ * @return None.
+ * 
+ */
+void tpool_destroy(TPool *pool);
+
+/**
+ * @brief Submits a task to the thread pool specified by pool.
+ * 
+ * A worker of the pool calls run with arg as its argument. Tasks may submit further tasks, which
+ * the worker running them is the first to pick up. The complexity is O(1), amortized over the
+ * growth of the deques.
+ * 
+ * @param[in] pool The thread pool.
+ * @param[in] run The function run by the task.
+ * @param[in] arg The argument passed to run.
+ * @return Returns 0 if submitting the task is successful, or -1 otherwise.
+ * 
+ */
+int tpool_submit(TPool *pool, void (*run)(void *arg), void *arg);
+
+/**
+ * @brief Waits until all the tasks submitted to the thread pool specified by pool have finished,
+ * including the tasks they submitted in turn.
+ * 
+ * It must not be called by a worker of the pool, whose tasks would never finish.
+ * 
+ * @param[in] pool The thread pool.
+ * @return None.
+ * 
+ */
+void tpool_wait(TPool *pool);
+
+/**
+ * @brief Determines which worker of the thread pool specified by pool is calling.
+ * 
+ * The complexity is O(1).
+ * 
+ * @param[in] pool The thread pool.
+ * @return Returns the number of the worker from 0 to the number of workers - 1, or -1 when the
+ * calling thread is not a worker of the pool.
+ * 
+ */
+int tpool_worker_id(const TPool *pool);
+
+/**
+ * @brief Macro that evaluates to the number of workers in the thread pool specified by pool.
+ * 
+ */
+#define tpool_size(pool) ((pool)->nworkers)
+
+#endif
@@ -0,0 +1,232 @@
+/**
+ * @file typesort.h
+ * @date 16 October 2026
+ * @brief Header for Sorting Algorithms specialized to a type.
+ *
+ * The sorts in sort.h work on any array through esize and a compare function, so each comparison
+ * is an indirect call and each move a memcpy of esize bytes. DEFINE_SORT instantiates the same
+ * algorithms for one element type, with the comparison inlined and elements moved by assignment:
+ *
+ *    DEFINE_SORT(int, int, a < b)
+ *    DEFINE_SORT(point, Point, a.x < b.x || (a.x == b.x && a.y < b.y))
+ *
+ * defines int_issort, int_qksort, int_hpsort and int_mgsort over int arrays, and likewise for
+ * point. The functions are static inline, so a translation unit only pays for the ones it calls.
+ */
+
+#ifndef TYPESORT_H
+#define TYPESORT_H
+
+#include <stdlib.h>
+
+/* Partitions with at most this many elements are finished with insertion sort. */
+#define TYPESORT_CUTOFF 16
+
+/**
+ * @brief Defines sorting functions named name_issort, name_qksort, name_hpsort and name_mgsort for
+ * arrays of type.
+ *
+ * Each function takes the array and its number of elements, and returns 0 if sorting is
+ * successful, or -1 otherwise. Only name_mgsort allocates storage, and so can fail. The sorts
+ * behave like issort, qksort, hpsort and mgsort in sort.h: name_issort and name_mgsort are stable,
+ * name_qksort is an introsort that falls back to name_hpsort, and all but name_issort run in
+ * O(n lg n).
+ *
+ * @param[in] name The prefix of the names of the functions.
+ * @param[in] type The type of the elements.
+ * @param[in] less An expression that is true when the element a sorts before the element b. It is
+ * evaluated with a and b bound to values of type, and should not have side effects.
+ */
+#define DEFINE_SORT(name, type, less)                                                             \
+                                                                                                  \
+static inline int name##_less(type a, type b)                                                     \
+{                                                                                                 \
+   return (less);                                                                                 \
+}                                                                                                 \
+                                                                                                  \
+static inline void name##_insertion(type *data, int i, int k)                                     \
+{                                                                                                 \
+   type key;                                                                                      \
+   int j, m;                                                                                      \
+                                                                                                  \
+   /* Repeatedly insert a key element among the sorted elements. */                               \
+   for (j = i + 1; j <= k; j++) {                                                                 \
+      key = data[j];                                                                              \
+                                                                                                  \
+      for (m = j - 1; m >= i && name##_less(key, data[m]); m--)                                   \
+         data[m + 1] = data[m];                                                                   \
+                                                                                                  \
+      data[m + 1] = key;                                                                          \
+   }                                                                                              \
+}                                                                                                 \
+                                                                                                  \
+static inline int name##_issort(type *data, int size)                                             \
+{                                                                                                 \
+   name##_insertion(data, 0, size - 1);                                                           \
+   return 0;                                                                                      \
+}                                                                                                 \
+                                                                                                  \
+static inline void name##_sift_down(type *data, int ipos, int size)                               \
+{                                                                                                 \
+   type temp;                                                                                     \
+   int cpos;                                                                                      \
+                                                                                                  \
+   /* Push the element at ipos down until it is not less than its children. */                   \
+   temp = data[ipos];                                                                             \
+                                                                                                  \
+   while ((cpos = 2 * ipos + 1) < size) {                                                         \
+      if (cpos + 1 < size && name##_less(data[cpos], data[cpos + 1]))                             \
+         cpos++;                                                                                  \
+                                                                                                  \
+      if (!name##_less(temp, data[cpos]))                                                         \
+         break;                                                                                   \
+                                                                                                  \
+      data[ipos] = data[cpos];                                                                    \
+      ipos = cpos;                                                                                \
+   }                                                                                              \
+                                                                                                  \
+   data[ipos] = temp;                                                                             \
+}                                                                                                 \
+                                                                                                  \
+static inline int name##_hpsort(type *data, int size)                                             \
+{                                                                                                 \
+   type temp;                                                                                     \
+   int i;                                                                                         \
+                                                                                                  \
+   /* Build a top-heavy heap bottom-up, then move its top behind the heap one at a time. */       \
+   for (i = size / 2 - 1; i >= 0; i--)                                                            \
+      name##_sift_down(data, i, size);                                                            \
+                                                                                                  \
+   for (i = size - 1; i > 0; i--) {                                                               \
+      temp = data[0];                                                                             \
+      data[0] = data[i];                                                                          \
+      data[i] = temp;                                                                             \
+      name##_sift_down(data, 0, i);                                                               \
+   }                                                                                              \
+                                                                                                  \
+   return 0;                                                                                      \
+}                                                                                                 \
+                                                                                                  \
+static inline void name##_introsort(type *data, int i, int k, int depth)                          \
+{                                                                                                 \
+   type pval, temp;                                                                               \
+   int lo, hi, m;                                                                                 \
+                                                                                                  \
+   while (k - i + 1 > TYPESORT_CUTOFF) {                                                          \
+      /* Fall back to heapsort when partitioning degrades. */                                     \
+      if (depth-- == 0) {                                                                         \
+         name##_hpsort(&data[i], k - i + 1);                                                      \
+         return;                                                                                  \
+      }                                                                                           \
+                                                                                                  \
+      /* Order the first, middle and last elements, and partition around their median. */         \
+      m = i + (k - i) / 2;                                                                        \
+                                                                                                  \
+      if (name##_less(data[m], data[i])) {                                                        \
+         temp = data[m]; data[m] = data[i]; data[i] = temp;                                       \
+      }                                                                                           \
+      if (name##_less(data[k], data[m])) {                                                        \
+         temp = data[k]; data[k] = data[m]; data[m] = temp;                                       \
+         if (name##_less(data[m], data[i])) {                                                     \
+            temp = data[m]; data[m] = data[i]; data[i] = temp;                                    \
+         }                                                                                        \
+      }                                                                                           \
+                                                                                                  \
+      pval = data[m];                                                                             \
+      lo = i;                                                                                     \
+      hi = k;                                                                                     \
+                                                                                                  \
+      /* Move elements less than the partition value left, and greater ones right. */             \
+      while (lo <= hi) {                                                                          \
+         while (name##_less(data[lo], pval))                                                      \
+            lo++;                                                                                 \
+         while (name##_less(pval, data[hi]))                                                      \
+            hi--;                                                                                 \
+                                                                                                  \
+         if (lo <= hi) {                                                                          \
+            temp = data[lo]; data[lo] = data[hi]; data[hi] = temp;                                \
+            lo++;                                                                                 \
+            hi--;                                                                                 \
+         }                                                                                        \
+      }                                                                                           \
+                                                                                                  \
+      /* Recursively sort the smaller partition and iterate on the larger. */                     \
+      if (hi - i < k - lo) {                                                                      \
+         name##_introsort(data, i, hi, depth);                                                    \
+         i = lo;                                                                                  \
+      }                                                                                           \
+      else {                                                                                      \
+         name##_introsort(data, lo, k, depth);                                                    \
+         k = hi;                                                                                  \
+      }                                                                                           \
+   }                                                                                              \
+                                                                                                  \
+   /* Finish small partitions with insertion sort. */                                             \
+   name##_insertion(data, i, k);                                                                  \
+}                                                                                                 \
+                                                                                                  \
+static inline int name##_qksort(type *data, int size)                                             \
+{                                                                                                 \
+   int depth, n;                                                                                  \
+                                                                                                  \
+   /* Allow twice the ideal depth of partitioning before falling back to heapsort. */             \
+   for (depth = 0, n = size; n > 1; n >>= 1)                                                      \
+      depth += 2;                                                                                 \
+                                                                                                  \
+   name##_introsort(data, 0, size - 1, depth);                                                    \
+   return 0;                                                                                      \
+}                                                                                                 \
+                                                                                                  \
+static inline void name##_divide(type *data, type *temp, int size)                                \
+{                                                                                                 \
+   int mid, i, j, k;                                                                              \
+                                                                                                  \
+   if (size <= TYPESORT_CUTOFF) {                                                                 \
+      name##_insertion(data, 0, size - 1);                                                        \
+      return;                                                                                     \
+   }                                                                                              \
+                                                                                                  \
+   /* Sort each half, and merge them unless they are already in order. */                         \
+   mid = size / 2;                                                                                \
+   name##_divide(data, temp, mid);                                                                \
+   name##_divide(&data[mid], temp, size - mid);                                                   \
+                                                                                                  \
+   if (!name##_less(data[mid], data[mid - 1]))                                                    \
+      return;                                                                                     \
+                                                                                                  \
+   /* Merge the left half, moved aside, with the right half, taking the left one on ties. */      \
+   for (i = 0; i < mid; i++)                                                                      \
+      temp[i] = data[i];                                                                          \
+                                                                                                  \
+   for (i = 0, j = mid, k = 0; i < mid && j < size; k++) {                                        \
+      if (name##_less(data[j], temp[i]))                                                          \
+         data[k] = data[j++];                                                                     \
+      else                                                                                        \
+         data[k] = temp[i++];                                                                     \
+   }                                                                                              \
+                                                                                                  \
+   while (i < mid)                                                                                \
+      data[k++] = temp[i++];                                                                      \
+}                                                                                                 \
+                                                                                                  \
+static inline int name##_mgsort(type *data, int size)                                             \
+{                                                                                                 \
+   type *temp;                                                                                    \
+                                                                                                  \
+   if (size <= TYPESORT_CUTOFF) {                                                                 \
+      name##_insertion(data, 0, size - 1);                                                        \
+      return 0;                                                                                   \
+   }                                                                                              \
+                                                                                                  \
+   /* Allocate storage for the left half of the largest merge. */                                 \
+   if ((temp = (type *)malloc((size_t)(size / 2) * sizeof(type))) == NULL)                        \
+      return -1;                                                                                  \
+                                                                                                  \
+   name##_divide(data, temp, size);                                                               \
+                                                                                                  \
+   /* Free the storage allocated for sorting. */                                                  \
+   free(temp);                                                                                    \
+   return 0;                                                                                      \
+}
+
+#endif
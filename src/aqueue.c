@@ -0,0 +1,149 @@
+/* Implementation of the Array-Backed Queue Abstract Datatype */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "aqueue.h"
+
+static int resize(AQueue *queue, int capacity)
+{
+    void **slots;
+    int first;
+
+    if (capacity == 0)
+    {
+        /* Release the storage of an empty queue. */
+        free(queue->slots);
+        queue->slots = NULL;
+        queue->capacity = 0;
+        queue->head = 0;
+        return 0;
+    }
+
+    /* Allocate storage for the new circular buffer. */
+    if ((slots = (void **)malloc(capacity * sizeof(void *))) == NULL)
+        return -1;
+
+    /* Unwrap the elements so that the head is at the first slot. */
+    if (queue->size > 0)
+    {
+        first = queue->capacity - queue->head;
+
+        if (first > queue->size)
+            first = queue->size;
+
+        memcpy(slots, &queue->slots[queue->head], first * sizeof(void *));
+        memcpy(&slots[first], queue->slots, (queue->size - first) *
+            sizeof(void *));
+    }
+
+    free(queue->slots);
+    queue->slots = slots;
+    queue->capacity = capacity;
+    queue->head = 0;
+
+    return 0;
+}
+
+void aqueue_init(AQueue *queue, void (*destroy)(void *data))
+{
+    /* Initialize the queue. */
+    queue->size = 0;
+    queue->capacity = 0;
+    queue->head = 0;
+    queue->destroy = destroy;
+    queue->slots = NULL;
+
+    return;
+}
+
+void aqueue_destroy(AQueue *queue)
+{
+    void *data;
+
+    /* Remove each element. */
+    while (aqueue_size(queue) > 0)
+    {
+        if (aqueue_dequeue(queue, &data) == 0 && queue->destroy != NULL)
+        {
+            /* Call a user-defined function to free dynamically allocated data. */
+            queue->destroy(data);
+        }
+    }
+
+    /* Free the storage allocated for the queue. */
+    free(queue->slots);
+
+    /* No operations are allowed now, but clear the structure as a precaution. */
+    memset(queue, 0, sizeof(AQueue));
+
+    return;
+}
+
+int aqueue_enqueue(AQueue *queue, const void *data)
+{
+    /* Double the capacity when the queue is full. */
+    if (queue->size == queue->capacity)
+    {
+        if (queue->capacity == (1 << 30))
+            return -1;
+
+        if (resize(queue, queue->capacity == 0 ? 16 : queue->capacity * 2) != 0)
+            return -1;
+    }
+
+    /* Enqueue the data after the last element. */
+    queue->slots[(queue->head + queue->size) & (queue->capacity - 1)] = (void *)data;
+    queue->size++;
+
+    return 0;
+}
+
+int aqueue_dequeue(AQueue *queue, void **data)
+{
+    /* Do not allow dequeuing from an empty queue. */
+    if (aqueue_size(queue) == 0)
+        return -1;
+
+    /* Dequeue the data at the head. */
+    *data = queue->slots[queue->head];
+    queue->head = (queue->head + 1) & (queue->capacity - 1);
+    queue->size--;
+
+    return 0;
+}
+
+int aqueue_reserve(AQueue *queue, int capacity)
+{
+    int n;
+
+    if (capacity <= queue->capacity)
+        return 0;
+
+    /* Do not allow a capacity that cannot be a power of two in an int. */
+    if (capacity > (1 << 30))
+        return -1;
+
+    /* Round the capacity up to a power of two. */
+    for (n = 16; n < capacity; n *= 2)
+        ;
+
+    return resize(queue, n);
+}
+
+int aqueue_shrink_to_fit(AQueue *queue)
+{
+    int n;
+
+    if (queue->size == 0)
+        return resize(queue, 0);
+
+    /* Find the smallest power of two that holds the elements. */
+    for (n = 1; n < queue->size; n *= 2)
+        ;
+
+    if (n == queue->capacity)
+        return 0;
+
+    return resize(queue, n);
+}
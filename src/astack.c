@@ -0,0 +1,109 @@
+/* Implementation of the Array-Backed Stack Abstract Datatype */
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "astack.h"
+
+static int resize(AStack *stack, int capacity)
+{
+    void **slots;
+
+    if (capacity == 0)
+    {
+        /* Release the storage of an empty stack. */
+        free(stack->slots);
+        stack->slots = NULL;
+        stack->capacity = 0;
+        return 0;
+    }
+
+    /* Adjust the storage used by the stack. */
+    if ((slots = (void **)realloc(stack->slots, capacity * sizeof(void *))) == NULL)
+        return -1;
+
+    stack->slots = slots;
+    stack->capacity = capacity;
+
+    return 0;
+}
+
+void astack_init(AStack *stack, void (*destroy)(void *data))
+{
+    /* Initialize the stack. */
+    stack->size = 0;
+    stack->capacity = 0;
+    stack->destroy = destroy;
+    stack->slots = NULL;
+
+    return;
+}
+
+void astack_destroy(AStack *stack)
+{
+    int i;
+
+    if (stack->destroy != NULL)
+    {
+        /* Call a user-defined function to free dynamically allocated data. */
+        for (i = stack->size - 1; i >= 0; i--)
+            stack->destroy(stack->slots[i]);
+    }
+
+    /* Free the storage allocated for the stack. */
+    free(stack->slots);
+
+    /* No operations are allowed now, but clear the structure as a precaution. */
+    memset(stack, 0, sizeof(AStack));
+
+    return;
+}
+
+int astack_push(AStack *stack, const void *data)
+{
+    /* Double the capacity when the stack is full. */
+    if (stack->size == stack->capacity)
+    {
+        if (stack->capacity > INT_MAX / 2)
+            return -1;
+
+        if (resize(stack, stack->capacity == 0 ? 16 : stack->capacity * 2) != 0)
+            return -1;
+    }
+
+    /* Push the data onto the stack. */
+    stack->slots[stack->size] = (void *)data;
+    stack->size++;
+
+    return 0;
+}
+
+int astack_pop(AStack *stack, void **data)
+{
+    /* Do not allow popping from an empty stack. */
+    if (astack_size(stack) == 0)
+        return -1;
+
+    /* Pop the data off the stack. */
+    stack->size--;
+    *data = stack->slots[stack->size];
+
+    return 0;
+}
+
+int astack_reserve(AStack *stack, int capacity)
+{
+    if (capacity <= stack->capacity)
+        return 0;
+
+    return resize(stack, capacity);
+}
+
+int astack_shrink_to_fit(AStack *stack)
+{
+    if (stack->size == stack->capacity)
+        return 0;
+
+    return resize(stack, stack->size);
+}
@@ -10,24 +10,128 @@
 
 #include "bistree.h"
 
+/* 
+ * Define private macros used by the binary search tree implementation.
+ */
+
+#define bistree_avl(node) ((AvlNode *)bitree_data(node))
+
+#define bistree_count(node) (bitree_is_eob(node) ? 0 : bistree_avl(node)->count)
+
 static void _destroy_right(BisTree *tree, BiTreeNode *node);
 
+static BisTreeNode *_alloc_node(BisTree *tree)
+{
+    BisTreeChunk *chunk;
+    BisTreeNode *node;
+    int i;
+
+    /* Allocate nodes one by one when the tree is not pooled. */
+    if (tree->chunk_size == 0)
+        return (BisTreeNode *)malloc(sizeof(BisTreeNode));
+
+    if (tree->free_nodes == NULL)
+    {
+        /* Carve a new chunk of nodes into the free nodes, linked through their left child. */
+        if ((chunk = (BisTreeChunk *)malloc(sizeof(BisTreeChunk) +
+            tree->chunk_size * sizeof(BisTreeNode))) == NULL)
+            return NULL;
+
+        chunk->next = tree->chunks;
+        tree->chunks = chunk;
+
+        for (i = tree->chunk_size - 1; i >= 0; i--)
+        {
+            chunk->nodes[i].node.left = tree->free_nodes;
+            tree->free_nodes = &chunk->nodes[i];
+        }
+    }
+
+    /* Take the first free node. */
+    node = tree->free_nodes;
+    tree->free_nodes = node->node.left;
+
+    return node;
+}
+
+static void _free_node(BisTree *tree, BiTreeNode *node)
+{
+    /* The node of the binary tree is the first member of the node of the binary search tree. */
+    if (tree->chunk_size == 0)
+    {
+        free(node);
+    }
+    else
+    {
+        /* Keep the node for later insertions. */
+        node->left = tree->free_nodes;
+        tree->free_nodes = node;
+    }
+
+    return;
+}
+
+static BiTreeNode *_find(BisTree *tree, const void *data)
+{
+    BiTreeNode *node;
+    int cmpval;
+
+    /* Descend from the root until the data is found or a branch ends. */
+    node = bitree_root(tree);
+
+    while (!bitree_is_eob(node))
+    {
+        cmpval = tree->compare(data, bistree_avl(node)->data);
+
+        if (cmpval < 0)
+            node = bitree_left(node);
+        else if (cmpval > 0)
+            node = bitree_right(node);
+        else
+            break;
+    }
+
+    return node;
+}
+
+static void _update(BiTreeNode *node)
+{
+    /* Count the nodes not hidden in the subtree from the counts of the children. */
+    bistree_avl(node)->count = bistree_count(bitree_left(node)) + bistree_count(bitree_right(node))
+        + !bistree_avl(node)->hidden;
+
+    return;
+}
+
 static void _rotate_left(BiTreeNode **node)
 {
     BiTreeNode *left, *grandchild;
 
     left = bitree_left(*node);
 
-    if (((AvlNode *)bitree_data(left))->factor == AVL_LFT_HEAVY)
+    if (((AvlNode *)bitree_data(left))->factor != AVL_RGT_HEAVY)
     {
         /*
-         * Perform an LL rotation.
-        */
-       bitree_left(*node) = bitree_right(left);
-       bitree_right(left) = *node;
-       ((AvlNode *)bitree_data(*node))->factor = AVL_BALANCED;
-       ((AvlNode *)bitree_data(left))->factor = AVL_BALANCED;
-       *node = left;
+         * Perform an LL rotation. The left child can be balanced only after a deletion, in which
+         * case the subtree keeps its height and both nodes remain unbalanced.
+         */
+        bitree_left(*node) = bitree_right(left);
+        bitree_right(left) = *node;
+
+        if (((AvlNode *)bitree_data(left))->factor == AVL_LFT_HEAVY)
+        {
+            ((AvlNode *)bitree_data(*node))->factor = AVL_BALANCED;
+            ((AvlNode *)bitree_data(left))->factor = AVL_BALANCED;
+        }
+        else
+        {
+            ((AvlNode *)bitree_data(*node))->factor = AVL_LFT_HEAVY;
+            ((AvlNode *)bitree_data(left))->factor = AVL_RGT_HEAVY;
+        }
+
+        _update(*node);
+        _update(left);
+        *node = left;
     }
     else
     {
@@ -66,6 +170,9 @@ static void _rotate_left(BiTreeNode **node)
         }
 
         ((AvlNode *)bitree_data(grandchild))->factor = AVL_BALANCED;
+        _update(*node);
+        _update(left);
+        _update(grandchild);
         *node = grandchild;
     }
 
@@ -78,15 +185,28 @@ static void _rotate_right(BiTreeNode **node)
 
     right = bitree_right(*node);
 
-    if (((AvlNode *)bitree_data(right))->factor == AVL_RGT_HEAVY)
+    if (((AvlNode *)bitree_data(right))->factor != AVL_LFT_HEAVY)
     {
         /*
-         * Perform an RR rotation.
+         * Perform an RR rotation. The right child can be balanced only after a deletion, in which
+         * case the subtree keeps its height and both nodes remain unbalanced.
          */
         bitree_right(*node) = bitree_left(right);
         bitree_left(right) = *node;
-        ((AvlNode *)bitree_data(*node))->factor = AVL_BALANCED;
-        ((AvlNode *)bitree_data(right))->factor = AVL_BALANCED;
+
+        if (((AvlNode *)bitree_data(right))->factor == AVL_RGT_HEAVY)
+        {
+            ((AvlNode *)bitree_data(*node))->factor = AVL_BALANCED;
+            ((AvlNode *)bitree_data(right))->factor = AVL_BALANCED;
+        }
+        else
+        {
+            ((AvlNode *)bitree_data(*node))->factor = AVL_RGT_HEAVY;
+            ((AvlNode *)bitree_data(right))->factor = AVL_LFT_HEAVY;
+        }
+
+        _update(*node);
+        _update(right);
         *node = right;
     }
     else
@@ -123,6 +243,9 @@ static void _rotate_right(BiTreeNode **node)
         }
 
         ((AvlNode *)bitree_data(grandchild))->factor = AVL_BALANCED;
+        _update(*node);
+        _update(right);
+        _update(grandchild);
         *node = grandchild;
     }
     
@@ -156,9 +279,8 @@ static void _destroy_left(BisTree *tree, BiTreeNode *node)
             tree->destroy(((AvlNode *)bitree_data(*position))->data);
         }
 
-        /* Free the AVL data in the node, then free the node itself. */
-        free((*position)->data);
-        free(*position);
+        /* Free the node, which holds its AVL data. */
+        _free_node(tree, *position);
         *position = NULL;
 
         /* Adjust the size of the tree to account for the destroyed node. */
@@ -194,9 +316,8 @@ static void _destroy_right(BisTree *tree, BiTreeNode *node)
             tree->destroy(((AvlNode *)bitree_data(*position))->data);
         }
 
-        /* Free the AVL data in the node, then free the node itself. */
-        free((*position)->data);
-        free(*position);
+        /* Free the node, which holds its AVL data. */
+        _free_node(tree, *position);
         *position = NULL;
 
         /* Adjust the size of the tree to account for the destroyed node. */
@@ -206,262 +327,581 @@ static void _destroy_right(BisTree *tree, BiTreeNode *node)
     return;
 }
 
-static int _insert(BisTree *tree, BiTreeNode **node, const void *data, int *balanced)
+static BiTreeNode *_build(BiTreeNode **nodes, int count, int *height)
 {
-    AvlNode *avl_data;
-
-    int cmpval, retval;
+    BiTreeNode *node;
+    int left, right, mid;
 
-    /* Insert the data into the tree */
-    if (bitree_is_eob(*node))
+    if (count == 0)
     {
-        /* Handle insertion into an empty tree */
+        *height = 0;
+        return NULL;
+    }
 
-        if ((avl_data = (AvlNode *)malloc(sizeof(AvlNode))) == NULL)
-            return -1;
-        
-        avl_data->factor = AVL_BALANCED;
-        avl_data->hidden = 0;
-        avl_data->data = (void *)data;
+    /* Make the middle node the root, and build its subtrees from the nodes on each side. */
+    mid = count / 2;
+    node = nodes[mid];
+    bitree_left(node) = _build(nodes, mid, &left);
+    bitree_right(node) = _build(&nodes[mid + 1], count - mid - 1, &right);
+    bistree_avl(node)->factor = left - right;
+    bistree_avl(node)->count = count;
 
-        return bitree_ins_left(tree, *node, avl_data);
+    *height = (left > right ? left : right) + 1;
+
+    return node;
+}
+
+void bistree_init(BisTree *tree, int (*compare)(const void *key1, const void *key2),
+                  void (*destroy)(void *data))
+{
+    /* Initialize the tree. */
+    bitree_init(tree, destroy);
+    tree->compare = compare;
+
+    return;
+}
+
+void bistree_init_pooled(BisTree *tree, int chunk_size,
+                         int (*compare)(const void *key1, const void *key2),
+                         void (*destroy)(void *data))
+{
+    /* Initialize the tree, allocating nodes in chunks. */
+    bistree_init(tree, compare, destroy);
+    tree->chunk_size = chunk_size > 0 ? chunk_size : BISTREE_CHUNK_SIZE;
+
+    return;
+}
+
+void bistree_destroy(BisTree *tree)
+{
+    BisTreeChunk *chunk;
+
+    /* Destroy all nodes in the tree. */
+    _destroy_left(tree, NULL);
+
+    /* Free the chunks of nodes of a pooled tree. */
+    while (tree->chunks != NULL)
+    {
+        chunk = tree->chunks;
+        tree->chunks = chunk->next;
+        free(chunk);
     }
-    else
+
+    /* No operations are allowed now, but clear the structure as a precaution. */
+    memset(tree, 0, sizeof(BisTree));
+
+    return;
+}
+
+int bistree_insert(BisTree *tree, const void *data)
+{
+    BiTreeNode **path[BISTREE_MAX_HEIGHT];
+    BiTreeNode **position, *child;
+    BisTreeNode *new_node;
+    AvlNode *avl_data;
+    int cmpval, depth = 0, i;
+
+    /* Descend from the root, recording the link followed at each level. */
+    position = &bitree_root(tree);
+
+    while (!bitree_is_eob(*position))
     {
-        /* Handle insertion into a tree that is not empty. */
-        cmpval = tree->compare(data, ((AvlNode *)bitree_data(*node))->data);
-        if (cmpval < 0)
+        avl_data = bistree_avl(*position);
+        cmpval = tree->compare(data, avl_data->data);
+
+        if (cmpval == 0)
         {
-            /* Move to the left. */
-            if (bitree_is_eob(bitree_left(*node)))
-            {
-                if ((avl_data = (AvlNode *)malloc(sizeof(AvlNode))) == NULL)
-                    return -1;
-                
-                avl_data->factor = AVL_BALANCED;
-                avl_data->hidden = 0;
-                avl_data->data = (void *)data;
+            /* Do nothing if the data is in the tree and not hidden. */
+            if (!avl_data->hidden)
+                return 1;
 
-                if (bitree_ins_left(tree, *node, avl_data) != 0)
-                    return -1;
-                
-                *balanced = 0;
-            }
-            else
-            {
-                if ((retval = _insert(tree, &bitree_left(*node), data, balanced)) != 0)
-                {
-                    return retval;
-                }
-            }
+            /* Destroy the hidden data since it is being replaced. */
+            if (tree->destroy != NULL)
+                tree->destroy(avl_data->data);
 
-            /* Ensure that the tree remains balanced. */
-            if(!(*balanced))
-            {
-                switch (((AvlNode*)bitree_data(*node))->factor)
-                {
-                case AVL_LFT_HEAVY:
-                    
-                    _rotate_left(node);
-                    *balanced = 1;
-                    break;
-                
-                case AVL_BALANCED:
-
-                    ((AvlNode *)bitree_data(*node))->factor = AVL_LFT_HEAVY;
-                    break;
-                
-                case AVL_RGT_HEAVY:
-
-                    ((AvlNode *)bitree_data(*node))->factor = AVL_BALANCED;
-                    *balanced = 1;
-                }
-            }
+            /* Insert the new data and mark it as not hidden, without rebalancing. */
+            avl_data->data = (void *)data;
+            avl_data->hidden = 0;
+            avl_data->count++;
+
+            for (i = 0; i < depth; i++)
+                bistree_avl(*path[i])->count++;
+
+            return 0;
         }
-        else if (cmpval > 0)
+
+        if (depth == BISTREE_MAX_HEIGHT)
+            return -1;
+
+        path[depth++] = position;
+        position = cmpval < 0 ? &bitree_left(*position) : &bitree_right(*position);
+    }
+
+    /* Allocate the node of the binary tree and its AVL data at once. */
+    if ((new_node = _alloc_node(tree)) == NULL)
+        return -1;
+
+    new_node->avl.data = (void *)data;
+    new_node->avl.hidden = 0;
+    new_node->avl.factor = AVL_BALANCED;
+    new_node->avl.count = 1;
+    new_node->node.data = &new_node->avl;
+    new_node->node.left = NULL;
+    new_node->node.right = NULL;
+
+    *position = &new_node->node;
+    tree->size++;
+
+    /* Count the node in every subtree on the path, before any rotation counts them again. */
+    for (i = 0; i < depth; i++)
+        bistree_avl(*path[i])->count++;
+
+    /* Walk back up the path while the subtree that received the node has grown taller. */
+    child = *position;
+
+    while (depth > 0)
+    {
+        position = path[--depth];
+        avl_data = bistree_avl(*position);
+
+        if (bitree_left(*position) == child)
         {
-            /* Move to the right. */
-            if(bitree_is_eob(bitree_right(*node)))
+            /* The left subtree has grown. */
+            if (avl_data->factor == AVL_LFT_HEAVY)
             {
-                if ((avl_data = (AvlNode *)malloc(sizeof(AvlNode))) == NULL)
-                    return -1;
-                
-                avl_data->factor = AVL_BALANCED;
-                avl_data->hidden = 0;
-                avl_data->data = (void *)data;
-
-                if (bitree_ins_right(tree, *node, avl_data) != 0)
-                    return -1;
-                
-                *balanced = 0;
+                _rotate_left(position);
+                break;
             }
-            else
+            else if (avl_data->factor == AVL_RGT_HEAVY)
             {
-                if ((retval = _insert(tree, &bitree_right(*node), data, balanced)) != 0)
-                {
-                    return retval;
-                }
+                avl_data->factor = AVL_BALANCED;
+                break;
             }
 
-            /* Ensure that the tree remains balanced. */            
-            if(!(*balanced))
-            {
-                switch (((AvlNode *)bitree_data(*node))->factor)
-                {
-                case AVL_LFT_HEAVY:
-                    
-                    ((AvlNode *)bitree_data(*node))->factor = AVL_BALANCED;
-                    *balanced = 1;
-                    break;
-                
-                case AVL_BALANCED:
-
-                    ((AvlNode *)bitree_data(*node))->factor = AVL_RGT_HEAVY;
-                    break;
-
-                case AVL_RGT_HEAVY:
-
-                    _rotate_right(node);
-                    *balanced = 1;
-                    break;                    
-                }
-            }
+            avl_data->factor = AVL_LFT_HEAVY;
         }
         else
         {
-            /* Handle finding a copy of the data. */
-            if (!((AvlNode *)bitree_data(*node))->hidden)
+            /* The right subtree has grown. */
+            if (avl_data->factor == AVL_RGT_HEAVY)
             {
-                /* Do nothing since the data is in the tree and it not hidden. */
-                return 1;
+                _rotate_right(position);
+                break;
             }
-            else
+            else if (avl_data->factor == AVL_LFT_HEAVY)
             {
-                /* Insert the new data and mark it as not hidden. */
-                if (tree->destroy != NULL)
-                {
-                    /* Destroy the hidden data since it is being replaced. */
-                    tree->destroy(((AvlNode *)bitree_data(*node))->data);
-                }
-
-                ((AvlNode *)bitree_data(*node))->data = (void *)data;
-                ((AvlNode *)bitree_data(*node))->hidden = 0;
-
-                /* Do not rebalance because the tree structure is unchanged. */
-                *balanced = 1;
+                avl_data->factor = AVL_BALANCED;
+                break;
             }
+
+            avl_data->factor = AVL_RGT_HEAVY;
         }
+
+        child = *position;
     }
 
     return 0;
 }
 
-static int _hide(BisTree *tree, BiTreeNode *node, const void *data)
+int bistree_remove(BisTree *tree, const void *data)
 {
-    int cmpval, retval;
+    BiTreeNode *node;
+    int cmpval;
+
+    /* Mark the node as hidden. */
+    node = _find(tree, data);
 
     if (bitree_is_eob(node))
-    {
-        /* Return that the data was not found. */
         return -1;
+
+    if (bistree_avl(node)->hidden)
+        return 0;
+
+    bistree_avl(node)->hidden = 1;
+
+    /* Descend again to take the node out of the count of every subtree holding it. */
+    node = bitree_root(tree);
+
+    while ((cmpval = tree->compare(data, bistree_avl(node)->data)) != 0)
+    {
+        bistree_avl(node)->count--;
+        node = cmpval < 0 ? bitree_left(node) : bitree_right(node);
     }
 
-    cmpval = tree->compare(data, ((AvlNode *)bitree_data(node))->data);
+    bistree_avl(node)->count--;
 
-    if (cmpval < 0)
+    return 0;
+}
+
+int bistree_lookup(BisTree *tree, void **data)
+{
+    BiTreeNode *node;
+
+    /* Return that the data was not found, unless it is in the tree and not hidden. */
+    node = _find(tree, *data);
+
+    if (bitree_is_eob(node) || bistree_avl(node)->hidden)
+        return -1;
+
+    /* Pass back the data from the tree. */
+    *data = bistree_avl(node)->data;
+
+    return 0;
+}
+
+int bistree_delete(BisTree *tree, void **data)
+{
+    BiTreeNode **path[BISTREE_MAX_HEIGHT];
+    BiTreeNode **position, **target, *node, *successor;
+    AvlNode *avl_data;
+    int sides[BISTREE_MAX_HEIGHT];
+    int cmpval, depth = 0, found, i;
+
+    /* Descend from the root, recording the link followed and the side taken at each level. */
+    position = &bitree_root(tree);
+
+    while (!bitree_is_eob(*position))
     {
-        /* Move to the left. */
-        retval = _hide(tree, bitree_left(node), data);
+        cmpval = tree->compare(*data, bistree_avl(*position)->data);
+
+        if (cmpval == 0)
+            break;
+
+        path[depth] = position;
+        sides[depth++] = cmpval > 0;
+        position = cmpval < 0 ? &bitree_left(*position) : &bitree_right(*position);
     }
-    else if (cmpval > 0)
+
+    /* Return that the data was not found, unless it is in the tree and not hidden. */
+    if (bitree_is_eob(*position) || bistree_avl(*position)->hidden)
+        return -1;
+
+    target = position;
+    node = *target;
+
+    if (bitree_is_eob(bitree_left(node)) || bitree_is_eob(bitree_right(node)))
     {
-        /* Move to the right. */
-        retval = _hide(tree, bitree_right(node), data);
+        /* Replace a node with at most one child by that child. */
+        *target = bitree_is_eob(bitree_left(node)) ? bitree_right(node) : bitree_left(node);
     }
     else
     {
-        /* Mark the node as hidden. */
-        ((AvlNode *)bitree_data(node))->hidden = 1;
-        retval = 0;
+        /* Find the successor of the node, the leftmost node of its right subtree. */
+        path[depth] = target;
+        sides[depth++] = 1;
+        found = depth;
+        position = &bitree_right(node);
+
+        while (!bitree_is_eob(bitree_left(*position)))
+        {
+            path[depth] = position;
+            sides[depth++] = 0;
+            position = &bitree_left(*position);
+        }
+
+        /* Unlink the successor, and put it in the place of the node. */
+        successor = *position;
+        *position = bitree_right(successor);
+
+        bitree_left(successor) = bitree_left(node);
+        bitree_right(successor) = bitree_right(node);
+        bistree_avl(successor)->factor = bistree_avl(node)->factor;
+        *target = successor;
+
+        /* The link below the node on the path now belongs to the successor. */
+        if (found < depth)
+            path[found] = &bitree_right(successor);
     }
 
-    return retval;
+    /*
+     * Count again every subtree on the path from the bottom up, before any rotation. The successor
+     * may be hidden, so the subtrees it left do not all lose a node.
+     */
+    for (i = depth - 1; i >= 0; i--)
+        _update(*path[i]);
+
+    /* Pass back the data, and free the node. */
+    *data = bistree_avl(node)->data;
+    _free_node(tree, node);
+    tree->size--;
+
+    /* Walk back up the path while the subtree that lost the node has become shorter. */
+    while (depth > 0)
+    {
+        position = path[--depth];
+        avl_data = bistree_avl(*position);
+
+        if (sides[depth] == 0)
+        {
+            /* The left subtree has become shorter. */
+            if (avl_data->factor == AVL_LFT_HEAVY)
+            {
+                avl_data->factor = AVL_BALANCED;
+                continue;
+            }
+            else if (avl_data->factor == AVL_BALANCED)
+            {
+                avl_data->factor = AVL_RGT_HEAVY;
+                break;
+            }
+
+            _rotate_right(position);
+        }
+        else
+        {
+            /* The right subtree has become shorter. */
+            if (avl_data->factor == AVL_RGT_HEAVY)
+            {
+                avl_data->factor = AVL_BALANCED;
+                continue;
+            }
+            else if (avl_data->factor == AVL_BALANCED)
+            {
+                avl_data->factor = AVL_LFT_HEAVY;
+                break;
+            }
+
+            _rotate_left(position);
+        }
+
+        /* A rotation leaves the subtree shorter only if its new root is balanced. */
+        if (bistree_avl(*position)->factor != AVL_BALANCED)
+            break;
+    }
+
+    return 0;
 }
 
-static int _lookup(BisTree *tree, BiTreeNode *node, void **data)
+int bistree_compact(BisTree *tree, double ratio)
 {
-    int cmpval, retval;
+    BiTreeNode *stack[BISTREE_MAX_HEIGHT];
+    BiTreeNode **nodes, *node, *next;
+    int hidden = 0, count = 0, top = 0, height;
 
-    if (bitree_is_eob(node))
+    /* Count the hidden nodes, visiting the tree in order. */
+    node = bitree_root(tree);
+
+    while (top > 0 || !bitree_is_eob(node))
     {
-        /* Return that the data was not found. */
-        return -1;
+        for (; !bitree_is_eob(node); node = bitree_left(node))
+            stack[top++] = node;
+
+        node = stack[--top];
+        hidden += bistree_avl(node)->hidden;
+        node = bitree_right(node);
     }
 
-    cmpval = tree->compare(*data, ((AvlNode *)bitree_data(node))->data);
+    /* Do nothing until enough of the nodes are hidden. */
+    if (hidden == 0 || hidden <= ratio * bitree_size(tree))
+        return 0;
+
+    /* Allocate storage for the nodes remaining, in order. */
+    if ((nodes = (BiTreeNode **)malloc((bitree_size(tree) - hidden + 1) * sizeof(BiTreeNode *))) == NULL)
+        return -1;
+
+    /* Gather the nodes not hidden in order, and free the hidden ones along with their data. */
+    node = bitree_root(tree);
 
-    if (cmpval < 0)
+    while (top > 0 || !bitree_is_eob(node))
     {
-        /* Move to the left. */
-        retval = _lookup(tree, bitree_left(node), data);
+        for (; !bitree_is_eob(node); node = bitree_left(node))
+            stack[top++] = node;
+
+        node = stack[--top];
+        next = bitree_right(node);
+
+        if (!bistree_avl(node)->hidden)
+        {
+            nodes[count++] = node;
+        }
+        else
+        {
+            if (tree->destroy != NULL)
+                tree->destroy(bistree_avl(node)->data);
+
+            _free_node(tree, node);
+        }
+
+        node = next;
     }
-    else if (cmpval > 0)
+
+    /* Rebuild the tree, perfectly balanced, from the nodes remaining. */
+    bitree_root(tree) = _build(nodes, count, &height);
+    tree->size = count;
+
+    free(nodes);
+
+    return 0;
+}
+
+int bistree_select(BisTree *tree, int k, void **data)
+{
+    BiTreeNode *node;
+    int left;
+
+    /* Do not allow a rank outside the nodes not hidden. */
+    if (k < 0 || k >= bistree_count(bitree_root(tree)))
+        return -1;
+
+    /* Descend from the root, using the counts of the left subtrees to steer toward rank k. */
+    node = bitree_root(tree);
+
+    while (1)
     {
-        /* Move to the right. */
-        retval = _lookup(tree, bitree_right(node), data);
+        left = bistree_count(bitree_left(node));
+
+        if (k < left)
+        {
+            node = bitree_left(node);
+        }
+        else if (k == left && !bistree_avl(node)->hidden)
+        {
+            break;
+        }
+        else
+        {
+            k -= left + !bistree_avl(node)->hidden;
+            node = bitree_right(node);
+        }
     }
-    else
+
+    /* Pass back the data from the tree. */
+    *data = bistree_avl(node)->data;
+
+    return 0;
+}
+
+int bistree_rank(BisTree *tree, const void *data)
+{
+    BiTreeNode *node;
+    int cmpval, rank = 0;
+
+    /* Descend from the root, counting the nodes not hidden that are less than the data. */
+    node = bitree_root(tree);
+
+    while (!bitree_is_eob(node))
     {
-        if (!((AvlNode *)bitree_data(node))->hidden)
+        cmpval = tree->compare(data, bistree_avl(node)->data);
+
+        if (cmpval <= 0)
         {
-            /* Pass back the data from the tree. */
-            *data = ((AvlNode *)bitree_data(node))->data;
-            retval = 0;
+            node = bitree_left(node);
+
+            if (cmpval == 0)
+                return rank + bistree_count(node);
         }
         else
         {
-            /* Return that the data was found. */
-            return -1;
+            rank += bistree_count(bitree_left(node)) + !bistree_avl(node)->hidden;
+            node = bitree_right(node);
         }
     }
 
-    return retval;
+    return rank;
 }
 
-void bistree_init(BisTree *tree, int (*compare)(const void *key1, const void *key2),
-                  void (*destroy)(void *data))
+static int _step(BisTreeCursor *cursor, int forward)
 {
-    /* Initialize the tree. */
-    bitree_init(tree, destroy);
-    tree->compare = compare;
+    BiTreeNode *node, *child;
 
-    return;
+    /* Move to the next node in order, or the previous one, until one is not hidden. */
+    do
+    {
+        node = cursor->path[cursor->depth - 1];
+        child = forward ? bitree_right(node) : bitree_left(node);
+
+        if (!bitree_is_eob(child))
+        {
+            /* Descend to the nearest node of the subtree on that side. */
+            for (; !bitree_is_eob(child); child = forward ? bitree_left(child) : bitree_right(child))
+                cursor->path[cursor->depth++] = child;
+        }
+        else
+        {
+            /* Climb until coming up from the other side of a node. */
+            do
+            {
+                child = cursor->path[--cursor->depth];
+            } while (cursor->depth > 0 && child == (forward
+                ? bitree_right(cursor->path[cursor->depth - 1])
+                : bitree_left(cursor->path[cursor->depth - 1])));
+
+            /* Return that the cursor has run off the end of the tree. */
+            if (cursor->depth == 0)
+                return -1;
+        }
+    } while (bistree_avl(cursor->path[cursor->depth - 1])->hidden);
+
+    return 0;
 }
 
-void bistree_destroy(BisTree *tree)
+int bistree_seek(BisTree *tree, BisTreeCursor *cursor, const void *data)
 {
-    /* Destroy all nodes in the tree. */
-    _destroy_left(tree, NULL);
+    BiTreeNode *node;
+    int cmpval, depth = 0;
 
-    /* No operations are allowed now, but clear the structure as a precaution. */
-    memset(tree, 0, sizeof(BisTree));
+    /* Descend from the root, remembering the last node not less than the data. */
+    cursor->depth = 0;
+    node = bitree_root(tree);
 
-    return;
+    while (!bitree_is_eob(node))
+    {
+        cursor->path[cursor->depth++] = node;
+        cmpval = data == NULL ? -1 : tree->compare(data, bistree_avl(node)->data);
+
+        if (cmpval <= 0)
+            depth = cursor->depth;
+
+        if (cmpval == 0)
+            break;
+
+        node = cmpval < 0 ? bitree_left(node) : bitree_right(node);
+    }
+
+    /* Return that every node is less than the data. */
+    if ((cursor->depth = depth) == 0)
+        return -1;
+
+    /* Move past the node found while it is hidden. */
+    if (bistree_avl(cursor->path[cursor->depth - 1])->hidden)
+        return _step(cursor, 1);
+
+    return 0;
 }
 
-int bistree_insert(BisTree *tree, const void *data)
+int bistree_next(BisTreeCursor *cursor)
 {
-    int balanced = 0;
+    /* Do not allow moving a cursor off the end of the tree. */
+    if (cursor->depth == 0)
+        return -1;
 
-    return _insert(tree, &bitree_root(tree), data, &balanced);
+    return _step(cursor, 1);
 }
 
-int bistree_remove(BisTree *tree, const void *data)
+int bistree_prev(BisTreeCursor *cursor)
 {
-    return _hide(tree, bitree_root(tree), data);
+    /* Do not allow moving a cursor off the end of the tree. */
+    if (cursor->depth == 0)
+        return -1;
+
+    return _step(cursor, 0);
 }
 
-int bistree_lookup(BisTree *tree, void **data)
+int bistree_range(BisTree *tree, const void *lo, const void *hi,
+                  int (*callback)(const void *data, void *ctx), void *ctx)
 {
-    return _lookup(tree, bitree_root(tree), data);
-}
\ No newline at end of file
+    BisTreeCursor cursor;
+    int retval, found;
+
+    /* Visit the nodes not hidden from lo up to hi, until the callback asks to stop. */
+    for (found = bistree_seek(tree, &cursor, lo); found == 0; found = bistree_next(&cursor))
+    {
+        if (hi != NULL && tree->compare(bistree_cursor_data(&cursor), hi) > 0)
+            break;
+
+        if ((retval = callback(bistree_cursor_data(&cursor), ctx)) != 0)
+            return retval;
+    }
+
+    return 0;
+}
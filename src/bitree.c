@@ -16,6 +16,9 @@ void bitree_init(BiTree *tree, void (*destroy)(void *data))
     tree->size = 0;
     tree->destroy = destroy;
     tree->root = NULL;
+    tree->chunk_size = 0;
+    tree->free_nodes = NULL;
+    tree->chunks = NULL;
 
     return;
 }
@@ -0,0 +1,739 @@
+/**
+ * @file bptree.c
+ * @date 16 October 2026
+ * @brief Implementation of the B+-Tree Abstract Datatype.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bptree.h"
+
+/*
+ * Define private macros used by the B+-tree implementation.
+ */
+
+#define bptree_leaf(node) ((BPTreeLeaf *)(node))
+
+#define bptree_inner(node) ((BPTreeInner *)(node))
+
+/*
+ * Define the fewest keys held by a node other than the root.
+ */
+
+#define BPTREE_MIN (BPTREE_ORDER / 2)
+
+/*
+ * Define the deepest path followed in a tree. Every inner node but the root has more than
+ * BPTREE_MIN children, so this is enough for any number of data an int can count.
+ */
+
+#define BPTREE_MAX_HEIGHT 16
+
+static BPTreeNode *_alloc_node(int leaf)
+{
+    BPTreeNode *node;
+
+    /* Allocate a leaf, or an inner node, with no keys. */
+    if ((node = (BPTreeNode *)malloc(leaf ? sizeof(BPTreeLeaf) : sizeof(BPTreeInner))) == NULL)
+        return NULL;
+
+    node->leaf = leaf;
+    node->count = 0;
+
+    if (leaf)
+    {
+        bptree_leaf(node)->prev = NULL;
+        bptree_leaf(node)->next = NULL;
+    }
+
+    return node;
+}
+
+static void _destroy_node(BPTree *tree, BPTreeNode *node)
+{
+    int i;
+
+    if (node->leaf)
+    {
+        if (tree->destroy != NULL)
+        {
+            for (i = 0; i < node->count; i++)
+            {
+                /* Call a user-defined function to free dynamically allocated data. */
+                tree->destroy(node->keys[i]);
+            }
+        }
+    }
+    else
+    {
+        for (i = 0; i <= node->count; i++)
+            _destroy_node(tree, bptree_inner(node)->children[i]);
+    }
+
+    free(node);
+
+    return;
+}
+
+static int _search(const BPTree *tree, const BPTreeNode *node, const void *data, int *found)
+{
+    int lo = 0, hi = node->count, mid, cmpval;
+
+    /* Bisect the keys of the node for the first one not less than the data. */
+    *found = 0;
+
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        cmpval = tree->compare(node->keys[mid], data);
+
+        if (cmpval < 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+            *found |= cmpval == 0;
+        }
+    }
+
+    return lo;
+}
+
+static BPTreeLeaf *_descend(const BPTree *tree, const void *data, BPTreeInner **path,
+                            int *indexes, int *depth)
+{
+    BPTreeNode *node;
+    int i, found;
+
+    /* Descend from the root to the leaf where the data belongs, recording the path if asked. */
+    node = tree->root;
+    *depth = 0;
+
+    while (!node->leaf)
+    {
+        /* A key equal to the data is the least data of the child to its right. */
+        i = _search(tree, node, data, &found) + found;
+
+        if (path != NULL)
+        {
+            path[*depth] = bptree_inner(node);
+            indexes[*depth] = i;
+        }
+
+        (*depth)++;
+        node = bptree_inner(node)->children[i];
+    }
+
+    return bptree_leaf(node);
+}
+
+static void *_split_leaf(BPTree *tree, BPTreeLeaf *leaf, int position, const void *data,
+                         BPTreeLeaf *right)
+{
+    void *keys[BPTREE_ORDER + 1];
+    int count;
+
+    /* Lay out the keys of the full leaf with the data inserted. */
+    memcpy(keys, leaf->node.keys, position * sizeof(void *));
+    keys[position] = (void *)data;
+    memcpy(&keys[position + 1], &leaf->node.keys[position],
+           (BPTREE_ORDER - position) * sizeof(void *));
+
+    /* Keep the lower half in the leaf, and move the upper half to the new leaf after it. */
+    count = (BPTREE_ORDER + 1) / 2;
+    memcpy(leaf->node.keys, keys, count * sizeof(void *));
+    memcpy(right->node.keys, &keys[count], (BPTREE_ORDER + 1 - count) * sizeof(void *));
+    leaf->node.count = count;
+    right->node.count = BPTREE_ORDER + 1 - count;
+
+    right->prev = leaf;
+    right->next = leaf->next;
+
+    if (leaf->next != NULL)
+        leaf->next->prev = right;
+    else
+        tree->last = right;
+
+    leaf->next = right;
+
+    /* Pass up the least data of the new leaf to separate it from the leaf. */
+    return right->node.keys[0];
+}
+
+static void *_split_inner(BPTreeInner *inner, int position, void *key, BPTreeNode *child,
+                          BPTreeInner *right)
+{
+    void *keys[BPTREE_ORDER + 1];
+    BPTreeNode *children[BPTREE_ORDER + 2];
+    int count;
+
+    /* Lay out the keys and children of the full node with the key and child inserted. */
+    memcpy(keys, inner->node.keys, position * sizeof(void *));
+    keys[position] = key;
+    memcpy(&keys[position + 1], &inner->node.keys[position],
+           (BPTREE_ORDER - position) * sizeof(void *));
+
+    memcpy(children, inner->children, (position + 1) * sizeof(BPTreeNode *));
+    children[position + 1] = child;
+    memcpy(&children[position + 2], &inner->children[position + 1],
+           (BPTREE_ORDER - position) * sizeof(BPTreeNode *));
+
+    /*
+     * Keep the lower half in the node and move the upper half to the new node. The key between
+     * them is passed up.
+     */
+    count = (BPTREE_ORDER + 1) / 2;
+    memcpy(inner->node.keys, keys, count * sizeof(void *));
+    memcpy(inner->children, children, (count + 1) * sizeof(BPTreeNode *));
+    memcpy(right->node.keys, &keys[count + 1], (BPTREE_ORDER - count) * sizeof(void *));
+    memcpy(right->children, &children[count + 1],
+           (BPTREE_ORDER + 1 - count) * sizeof(BPTreeNode *));
+    inner->node.count = count;
+    right->node.count = BPTREE_ORDER - count;
+
+    return keys[count];
+}
+
+static void _borrow_left(BPTreeInner *parent, int i)
+{
+    BPTreeNode *node, *left;
+
+    node = parent->children[i];
+    left = parent->children[i - 1];
+
+    /* Make room at the front of the node. */
+    memmove(&node->keys[1], node->keys, node->count * sizeof(void *));
+
+    if (node->leaf)
+    {
+        /* Move the last data of the left sibling, which becomes the least data of the node. */
+        node->keys[0] = left->keys[left->count - 1];
+    }
+    else
+    {
+        /* Rotate the last child of the left sibling through the parent. */
+        memmove(&bptree_inner(node)->children[1], bptree_inner(node)->children,
+                (node->count + 1) * sizeof(BPTreeNode *));
+        bptree_inner(node)->children[0] = bptree_inner(left)->children[left->count];
+        node->keys[0] = parent->node.keys[i - 1];
+    }
+
+    parent->node.keys[i - 1] = left->keys[left->count - 1];
+    left->count--;
+    node->count++;
+
+    return;
+}
+
+static void _borrow_right(BPTreeInner *parent, int i)
+{
+    BPTreeNode *node, *right;
+
+    node = parent->children[i];
+    right = parent->children[i + 1];
+
+    if (node->leaf)
+    {
+        /* Move the least data of the right sibling, whose next data becomes its least. */
+        node->keys[node->count] = right->keys[0];
+        parent->node.keys[i] = right->keys[1];
+    }
+    else
+    {
+        /* Rotate the first child of the right sibling through the parent. */
+        node->keys[node->count] = parent->node.keys[i];
+        bptree_inner(node)->children[node->count + 1] = bptree_inner(right)->children[0];
+        parent->node.keys[i] = right->keys[0];
+        memmove(bptree_inner(right)->children, &bptree_inner(right)->children[1],
+                right->count * sizeof(BPTreeNode *));
+    }
+
+    memmove(right->keys, &right->keys[1], (right->count - 1) * sizeof(void *));
+    right->count--;
+    node->count++;
+
+    return;
+}
+
+static void _merge(BPTree *tree, BPTreeInner *parent, int i)
+{
+    BPTreeNode *node, *right;
+
+    node = parent->children[i];
+    right = parent->children[i + 1];
+
+    if (node->leaf)
+    {
+        /* Append the data of the right sibling, and unlink it from the leaves. */
+        memcpy(&node->keys[node->count], right->keys, right->count * sizeof(void *));
+        node->count += right->count;
+
+        bptree_leaf(node)->next = bptree_leaf(right)->next;
+
+        if (bptree_leaf(right)->next != NULL)
+            bptree_leaf(right)->next->prev = bptree_leaf(node);
+        else
+            tree->last = bptree_leaf(node);
+    }
+    else
+    {
+        /*
+         * Append the key between the nodes from the parent, then the keys and children of the
+         * right sibling.
+         */
+        node->keys[node->count] = parent->node.keys[i];
+        memcpy(&node->keys[node->count + 1], right->keys, right->count * sizeof(void *));
+        memcpy(&bptree_inner(node)->children[node->count + 1], bptree_inner(right)->children,
+               (right->count + 1) * sizeof(BPTreeNode *));
+        node->count += right->count + 1;
+    }
+
+    free(right);
+
+    /* Remove the key and the child of the right sibling from the parent. */
+    memmove(&parent->node.keys[i], &parent->node.keys[i + 1],
+            (parent->node.count - i - 1) * sizeof(void *));
+    memmove(&parent->children[i + 1], &parent->children[i + 2],
+            (parent->node.count - i - 1) * sizeof(BPTreeNode *));
+    parent->node.count--;
+
+    return;
+}
+
+void bptree_init(BPTree *tree, int (*compare)(const void *key1, const void *key2),
+                 void (*destroy)(void *data))
+{
+    /* Initialize the tree. */
+    tree->size = 0;
+    tree->compare = compare;
+    tree->destroy = destroy;
+    tree->root = NULL;
+    tree->first = NULL;
+    tree->last = NULL;
+
+    return;
+}
+
+void bptree_destroy(BPTree *tree)
+{
+    /* Destroy all the nodes in the tree. */
+    if (tree->root != NULL)
+        _destroy_node(tree, tree->root);
+
+    /* No operations are allowed now, but clear the structure as a precaution. */
+    memset(tree, 0, sizeof(BPTree));
+
+    return;
+}
+
+int bptree_insert(BPTree *tree, const void *data)
+{
+    BPTreeInner *path[BPTREE_MAX_HEIGHT], *inner;
+    BPTreeNode *spare[BPTREE_MAX_HEIGHT + 1], *child;
+    BPTreeLeaf *leaf;
+    void *key;
+    int indexes[BPTREE_MAX_HEIGHT];
+    int depth, position, found, splits, needed, level, i;
+
+    /* Handle insertion into an empty tree. */
+    if (tree->root == NULL)
+    {
+        if ((tree->root = _alloc_node(1)) == NULL)
+            return -1;
+
+        tree->root->keys[0] = (void *)data;
+        tree->root->count = 1;
+        tree->first = bptree_leaf(tree->root);
+        tree->last = bptree_leaf(tree->root);
+        tree->size = 1;
+
+        return 0;
+    }
+
+    /* Do nothing if the data is already in the tree. */
+    leaf = _descend(tree, data, path, indexes, &depth);
+    position = _search(tree, &leaf->node, data, &found);
+
+    if (found)
+        return 1;
+
+    /* Count the full nodes from the leaf up, which must all be split. */
+    splits = 0;
+
+    if (leaf->node.count == BPTREE_ORDER)
+    {
+        for (splits = 1; splits <= depth; splits++)
+        {
+            if (path[depth - splits]->node.count < BPTREE_ORDER)
+                break;
+        }
+    }
+
+    /* Allocate the new nodes before changing anything, including a new root if the root splits. */
+    needed = splits + (splits == depth + 1);
+
+    for (i = 0; i < needed; i++)
+    {
+        if ((spare[i] = _alloc_node(i == 0)) == NULL)
+        {
+            while (i > 0)
+                free(spare[--i]);
+
+            return -1;
+        }
+    }
+
+    tree->size++;
+
+    if (splits == 0)
+    {
+        /* Insert the data into a leaf with room for it. */
+        memmove(&leaf->node.keys[position + 1], &leaf->node.keys[position],
+                (leaf->node.count - position) * sizeof(void *));
+        leaf->node.keys[position] = (void *)data;
+        leaf->node.count++;
+
+        return 0;
+    }
+
+    /* Split the leaf, and each full node above it, passing up a key and a new child each time. */
+    key = _split_leaf(tree, leaf, position, data, bptree_leaf(spare[0]));
+    child = spare[0];
+
+    for (i = 1, level = depth - 1; i < splits; i++, level--)
+    {
+        key = _split_inner(path[level], indexes[level], key, child, bptree_inner(spare[i]));
+        child = spare[i];
+    }
+
+    if (level >= 0)
+    {
+        /* Insert the key and child into the first node with room for them. */
+        inner = path[level];
+        position = indexes[level];
+
+        memmove(&inner->node.keys[position + 1], &inner->node.keys[position],
+                (inner->node.count - position) * sizeof(void *));
+        memmove(&inner->children[position + 2], &inner->children[position + 1],
+                (inner->node.count - position) * sizeof(BPTreeNode *));
+        inner->node.keys[position] = key;
+        inner->children[position + 1] = child;
+        inner->node.count++;
+    }
+    else
+    {
+        /* Grow the tree by one level with a new root over the two halves of the old one. */
+        inner = bptree_inner(spare[splits]);
+        inner->node.keys[0] = key;
+        inner->children[0] = tree->root;
+        inner->children[1] = child;
+        inner->node.count = 1;
+        tree->root = &inner->node;
+    }
+
+    return 0;
+}
+
+int bptree_remove(BPTree *tree, void **data)
+{
+    BPTreeInner *path[BPTREE_MAX_HEIGHT], *parent;
+    BPTreeNode *node;
+    BPTreeLeaf *leaf;
+    int indexes[BPTREE_MAX_HEIGHT];
+    int depth, position, found, level, i;
+
+    /* Do not allow removal from an empty tree. */
+    if (tree->root == NULL)
+        return -1;
+
+    leaf = _descend(tree, *data, path, indexes, &depth);
+    position = _search(tree, &leaf->node, *data, &found);
+
+    if (!found)
+        return -1;
+
+    /* Remove the data from the leaf, and pass it back. */
+    *data = leaf->node.keys[position];
+    memmove(&leaf->node.keys[position], &leaf->node.keys[position + 1],
+            (leaf->node.count - position - 1) * sizeof(void *));
+    leaf->node.count--;
+    tree->size--;
+
+    /* Free a root leaf left empty. */
+    if (leaf->node.count == 0)
+    {
+        free(leaf);
+        tree->root = NULL;
+        tree->first = NULL;
+        tree->last = NULL;
+
+        return 0;
+    }
+
+    /*
+     * The data removed now belongs to the caller, so the key above the leaf that held its least
+     * data, in the lowest node where the path turned right, must name the new least data.
+     */
+    if (position == 0)
+    {
+        for (level = depth - 1; level >= 0; level--)
+        {
+            if (indexes[level] > 0)
+            {
+                path[level]->node.keys[indexes[level] - 1] = leaf->node.keys[0];
+                break;
+            }
+        }
+    }
+
+    /* Walk back up the path while nodes are left with too few keys. */
+    node = &leaf->node;
+
+    for (level = depth - 1; level >= 0 && node->count < BPTREE_MIN; level--)
+    {
+        parent = path[level];
+        i = indexes[level];
+
+        /* Take a key from a sibling that can spare one, or else merge with a sibling. */
+        if (i > 0 && parent->children[i - 1]->count > BPTREE_MIN)
+            _borrow_left(parent, i);
+        else if (i < parent->node.count && parent->children[i + 1]->count > BPTREE_MIN)
+            _borrow_right(parent, i);
+        else if (i > 0)
+            _merge(tree, parent, i - 1);
+        else
+            _merge(tree, parent, i);
+
+        node = &parent->node;
+    }
+
+    /* Shrink the tree by one level when the root is left with a single child. */
+    if (!tree->root->leaf && tree->root->count == 0)
+    {
+        node = tree->root;
+        tree->root = bptree_inner(node)->children[0];
+        free(node);
+    }
+
+    return 0;
+}
+
+int bptree_lookup(const BPTree *tree, void **data)
+{
+    BPTreeLeaf *leaf;
+    int depth, position, found;
+
+    if (tree->root == NULL)
+        return -1;
+
+    /* Search the leaf where the data belongs. */
+    leaf = _descend(tree, *data, NULL, NULL, &depth);
+    position = _search(tree, &leaf->node, *data, &found);
+
+    if (!found)
+        return -1;
+
+    /* Pass back the data from the tree. */
+    *data = leaf->node.keys[position];
+
+    return 0;
+}
+
+int bptree_load(BPTree *tree, void **data, int size)
+{
+    BPTreeNode **nodes, *node;
+    void **least;
+    int counts[BPTREE_MAX_HEIGHT];
+    int levels, total, share, below, first, next, level, i, j;
+
+    /* Do not allow loading a tree that is not empty, or data out of order. */
+    if (tree->root != NULL)
+        return -1;
+
+    for (i = 1; i < size; i++)
+    {
+        if (tree->compare(data[i - 1], data[i]) >= 0)
+            return -1;
+    }
+
+    if (size == 0)
+        return 0;
+
+    /* Work out the number of nodes at each level, from the leaves up to the root. */
+    counts[0] = (size + BPTREE_ORDER - 1) / BPTREE_ORDER;
+    total = counts[0];
+
+    for (levels = 1; counts[levels - 1] > 1; levels++)
+    {
+        counts[levels] = (counts[levels - 1] + BPTREE_ORDER) / (BPTREE_ORDER + 1);
+        total += counts[levels];
+    }
+
+    /* Allocate all the nodes, and the least data of each, before building anything. */
+    if ((nodes = (BPTreeNode **)malloc(total * sizeof(BPTreeNode *))) == NULL)
+        return -1;
+
+    if ((least = (void **)malloc(counts[0] * sizeof(void *))) == NULL)
+    {
+        free(nodes);
+        return -1;
+    }
+
+    for (i = 0; i < total; i++)
+    {
+        if ((nodes[i] = _alloc_node(i < counts[0])) == NULL)
+        {
+            while (i > 0)
+                free(nodes[--i]);
+
+            free(least);
+            free(nodes);
+
+            return -1;
+        }
+    }
+
+    /* Share the data evenly between the leaves, so each holds at least half as many as it can. */
+    for (i = 0, j = 0; i < counts[0]; i++)
+    {
+        node = nodes[i];
+        share = size / counts[0] + (i < size % counts[0]);
+        memcpy(node->keys, &data[j], share * sizeof(void *));
+        node->count = share;
+        least[i] = data[j];
+        j += share;
+
+        bptree_leaf(node)->prev = i > 0 ? bptree_leaf(nodes[i - 1]) : NULL;
+        bptree_leaf(node)->next = i < counts[0] - 1 ? bptree_leaf(nodes[i + 1]) : NULL;
+    }
+
+    /* Share the nodes of each level evenly between the nodes of the level above. */
+    first = 0;
+
+    for (level = 1; level < levels; level++)
+    {
+        below = counts[level - 1];
+        next = first + below;
+
+        for (i = 0, j = 0; i < counts[level]; i++)
+        {
+            node = nodes[next + i];
+            share = below / counts[level] + (i < below % counts[level]);
+            memcpy(bptree_inner(node)->children, &nodes[first + j], share * sizeof(BPTreeNode *));
+            memcpy(node->keys, &least[j + 1], (share - 1) * sizeof(void *));
+            node->count = share - 1;
+
+            /* The least data of a node is that of its first child, not yet overwritten. */
+            least[i] = least[j];
+            j += share;
+        }
+
+        first = next;
+    }
+
+    tree->root = nodes[total - 1];
+    tree->first = bptree_leaf(nodes[0]);
+    tree->last = bptree_leaf(nodes[counts[0] - 1]);
+    tree->size = size;
+
+    free(least);
+    free(nodes);
+
+    return 0;
+}
+
+int bptree_seek(const BPTree *tree, BPTreeCursor *cursor, const void *data)
+{
+    int depth, found;
+
+    if (tree->root == NULL)
+    {
+        cursor->leaf = NULL;
+        return -1;
+    }
+
+    if (data == NULL)
+    {
+        /* Position the cursor at the least data. */
+        cursor->leaf = tree->first;
+        cursor->position = 0;
+
+        return 0;
+    }
+
+    /* Position the cursor at the first data not less than the data in its leaf. */
+    cursor->leaf = _descend(tree, data, NULL, NULL, &depth);
+    cursor->position = _search(tree, &cursor->leaf->node, data, &found);
+
+    /* All the data in the leaf may be less, in which case the next leaf holds the data sought. */
+    if (cursor->position == cursor->leaf->node.count)
+    {
+        cursor->leaf = cursor->leaf->next;
+        cursor->position = 0;
+    }
+
+    return cursor->leaf == NULL ? -1 : 0;
+}
+
+int bptree_next(BPTreeCursor *cursor)
+{
+    /* Do not allow moving a cursor off the end of the tree. */
+    if (cursor->leaf == NULL)
+        return -1;
+
+    /* Move to the next data in the leaf, or to the first data of the next leaf. */
+    if (++cursor->position == cursor->leaf->node.count)
+    {
+        cursor->leaf = cursor->leaf->next;
+        cursor->position = 0;
+    }
+
+    return cursor->leaf == NULL ? -1 : 0;
+}
+
+int bptree_prev(BPTreeCursor *cursor)
+{
+    /* Do not allow moving a cursor off the end of the tree. */
+    if (cursor->leaf == NULL)
+        return -1;
+
+    /* Move to the previous data in the leaf, or to the last data of the previous leaf. */
+    if (--cursor->position < 0)
+    {
+        cursor->leaf = cursor->leaf->prev;
+
+        if (cursor->leaf != NULL)
+            cursor->position = cursor->leaf->node.count - 1;
+    }
+
+    return cursor->leaf == NULL ? -1 : 0;
+}
+
+int bptree_range(const BPTree *tree, const void *lo, const void *hi,
+                 int (*callback)(const void *data, void *ctx), void *ctx)
+{
+    BPTreeCursor cursor;
+    BPTreeLeaf *leaf;
+    int retval, i;
+
+    if (bptree_seek(tree, &cursor, lo) != 0)
+        return 0;
+
+    /* Visit the data from lo up to hi along the leaves, until the callback asks to stop. */
+    for (leaf = cursor.leaf, i = cursor.position; leaf != NULL; leaf = leaf->next, i = 0)
+    {
+        for (; i < leaf->node.count; i++)
+        {
+            if (hi != NULL && tree->compare(leaf->node.keys[i], hi) > 0)
+                return 0;
+
+            if ((retval = callback(leaf->node.keys[i], ctx)) != 0)
+                return retval;
+        }
+    }
+
+    return 0;
+}
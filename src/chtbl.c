@@ -11,6 +11,105 @@
 #include "list.h"
 #include "chtbl.h"
 
+/*
+ * Define a private macro that hashes a key into one of a number of buckets.
+ */
+
+#define chtbl_bucket(htbl, key, buckets) ((int)((unsigned int)(htbl)->h(key) % (unsigned int)(buckets)))
+
+static void migrate(CHTbl *htbl, int steps)
+{
+    ListElmt *element;
+    List *from, *to;
+
+    /* Move the elements of the next old buckets into the new buckets. */
+    while (htbl->old_table != NULL && steps-- > 0)
+    {
+        from = &htbl->old_table[htbl->migrated];
+
+        while ((element = list_head(from)) != NULL)
+        {
+            /* Relink the element at the head of its new bucket without reallocating it. */
+            from->head = list_next(element);
+            from->size--;
+
+            to = &htbl->table[chtbl_bucket(htbl, list_data(element), htbl->buckets)];
+
+            if (list_size(to) == 0)
+                to->tail = element;
+
+            element->next = to->head;
+            to->head = element;
+            to->size++;
+        }
+
+        from->tail = NULL;
+
+        /* Free the old buckets once all of them have been migrated. */
+        if (++htbl->migrated == htbl->old_buckets)
+        {
+            free(htbl->old_table);
+            htbl->old_table = NULL;
+            htbl->old_buckets = 0;
+            htbl->migrated = 0;
+        }
+    }
+
+    return;
+}
+
+static void resize(CHTbl *htbl)
+{
+    List *table;
+    int buckets, i;
+
+    /* Do not start resizing while a previous resize is being migrated. */
+    if (htbl->max_load <= 0 || htbl->old_table != NULL)
+        return;
+
+    if (htbl->size > htbl->max_load * htbl->buckets && htbl->buckets <= (1 << 29))
+        buckets = htbl->buckets * 2;
+    else if (htbl->size < htbl->max_load * htbl->buckets / 4 && htbl->buckets / 2 >= htbl->min_buckets)
+        buckets = htbl->buckets / 2;
+    else
+        return;
+
+    /* Keep the current buckets if the new ones cannot be allocated. */
+    if ((table = (List *)malloc(buckets * sizeof(List))) == NULL)
+        return;
+
+    for (i = 0; i < buckets; i++)
+        list_init(&table[i], htbl->destroy);
+
+    /* Start migrating the elements from the current buckets. */
+    htbl->old_table = htbl->table;
+    htbl->old_buckets = htbl->buckets;
+    htbl->migrated = 0;
+    htbl->table = table;
+    htbl->buckets = buckets;
+
+    return;
+}
+
+static ListElmt *find(const List *bucket, int (*match)(const void *key1, const void *key2),
+                      const void *data, ListElmt **prev)
+{
+    ListElmt *element;
+
+    /* Search for the data in the bucket. */
+    *prev = NULL;
+
+    for (element = list_head(bucket); element != NULL; element = list_next(element))
+    {
+        if (match(data, list_data(element)))
+            return element;
+
+        *prev = element;
+    }
+
+    return NULL;
+}
+
 int chtbl_init(CHTbl *htbl, int buckets, int (*h)(const void *key), 
                int (*match)(const void *key1, const void *key2), void (*destroy)(void *data))
 {
@@ -34,6 +133,13 @@ int chtbl_init(CHTbl *htbl, int buckets, int (*h)(const void *key),
     /* Initialize the number of elements in the table. */
     htbl->size = 0;
 
+    /* Initialize the resizing policy, with no migration in progress. */
+    htbl->max_load = CHTBL_MAX_LOAD;
+    htbl->min_buckets = buckets;
+    htbl->old_table = NULL;
+    htbl->old_buckets = 0;
+    htbl->migrated = 0;
+
     return 0;
 }
 
@@ -47,8 +153,15 @@ void chtbl_destroy(CHTbl *htbl)
         list_destroy(&htbl->table[i]);
     }
 
+    /* Destroy each bucket that has not been migrated yet. */
+    for (i = htbl->migrated; i < htbl->old_buckets; i++)
+    {
+        list_destroy(&htbl->old_table[i]);
+    }
+
     /* Free the storage allocated for the hash table. */
     free(htbl->table);
+    free(htbl->old_table);
 
     /* No operations are allowed now, but clear the structure as a precaution. */
     memset(htbl, 0, sizeof(CHTbl));
@@ -56,6 +169,14 @@ void chtbl_destroy(CHTbl *htbl)
     return;
 }
 
+void chtbl_set_max_load(CHTbl *htbl, double max_load)
+{
+    /* Set the load factor used by subsequent insertions and removals. */
+    htbl->max_load = max_load > 0 ? max_load : 0;
+
+    return;
+}
+
 int chtbl_insert(CHTbl *htbl, const void *data)
 {
     void *temp;
@@ -68,11 +189,17 @@ int chtbl_insert(CHTbl *htbl, const void *data)
         return 1;
     
     /* Hash the key */
-    bucket = htbl->h(data) % htbl->buckets;
+    bucket = chtbl_bucket(htbl, data, htbl->buckets);
 
     /* Insert the data into the bucket. */
     if ((retval = list_ins_next(&htbl->table[bucket], NULL, data)) == 0)
+    {
         htbl->size++;
+
+        /* Amortize any migration in progress, then check whether to grow. */
+        migrate(htbl, CHTBL_REHASH_STEP);
+        resize(htbl);
+    }
     
     return retval;
 
@@ -81,56 +208,51 @@ int chtbl_insert(CHTbl *htbl, const void *data)
 int chtbl_remove(CHTbl *htbl, void **data)
 {
     ListElmt *element, *prev;
-    int bucket;
+    List *bucket;
 
-    /* Hash the key */
-    bucket = htbl->h(*data) % htbl->buckets;
+    /* Search for the data in its bucket, then in its old bucket if not yet migrated. */
+    bucket = &htbl->table[chtbl_bucket(htbl, *data, htbl->buckets)];
 
-    /* Search for the data in the bucket. */
-    prev = NULL;
-
-    for (element = list_head(&htbl->table[bucket]); element != NULL; element = list_next(element))
+    if ((element = find(bucket, htbl->match, *data, &prev)) == NULL && htbl->old_table != NULL)
     {
-        if (htbl->match(*data, list_data(element)))
-        {
-            /* Remove the data from the bucket */
-            if (list_rem_next(&htbl->table[bucket], prev, data) == 0)
-            {
-                htbl->size--;
-                return 0;
-            }
-            else
-            {
-                return -1;
-            }
-        }
-
-        prev = element;
+        bucket = &htbl->old_table[chtbl_bucket(htbl, *data, htbl->old_buckets)];
+        element = find(bucket, htbl->match, *data, &prev);
     }
 
     /* Return that the data was not found. */
-    return -1;
+    if (element == NULL)
+        return -1;
+
+    /* Remove the data from the bucket */
+    if (list_rem_next(bucket, prev, data) != 0)
+        return -1;
+
+    htbl->size--;
+
+    /* Amortize any migration in progress, then check whether to shrink. */
+    migrate(htbl, CHTBL_REHASH_STEP);
+    resize(htbl);
+
+    return 0;
 }
 
 int chtbl_lookup(const CHTbl *htbl, void **data)
 {
-    ListElmt *element;
-    int bucket;
+    ListElmt *element, *prev;
 
-    /* Hash the key */
-    bucket = htbl->h(*data) % htbl->buckets;
+    /* Search for the data in its bucket, then in its old bucket if not yet migrated. */
+    element = find(&htbl->table[chtbl_bucket(htbl, *data, htbl->buckets)], htbl->match, *data,
+                   &prev);
 
-    /* Search for the data in the bucket. */
-    for (element = list_head(&htbl->table[bucket]); element != NULL; element = list_next(element))
-    {
-        if(htbl->match(*data, list_data(element)))
-        {
-            /* Pass back the data from the table. */
-            *data = list_data(element);
-            return 0;
-        }
-    }
+    if (element == NULL && htbl->old_table != NULL)
+        element = find(&htbl->old_table[chtbl_bucket(htbl, *data, htbl->old_buckets)],
+                       htbl->match, *data, &prev);
 
     /* Return that the data was not found. */
-    return -1;
+    if (element == NULL)
+        return -1;
+
+    /* Pass back the data from the table. */
+    *data = list_data(element);
+    return 0;
 }
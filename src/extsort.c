@@ -0,0 +1,273 @@
+/**
+ * @file extsort.c
+ * @date 16 October 2026
+ * @brief Implementation of the External Merge Sort.
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "extsort.h"
+#include "heap.h"
+#include "sort.h"
+
+/* Smallest read buffer for each run when the fan-in is derived from the memory available. */
+#define EXTSORT_MIN_BUFFER (64 * 1024)
+
+/* Define a structure for the position of the merge in each run. */
+typedef struct ExtCursor_ {
+   FILE *fp;
+   char *buffer;
+   size_t count;
+   size_t pos;
+   int run;
+   int esize;
+   int (*compare)(const void *key1, const void *key2);
+} ExtCursor;
+
+static int compare_cursor(const void *key1, const void *key2)
+{
+   const ExtCursor *cursor1 = key1, *cursor2 = key2;
+   int retval;
+
+   /* Order the cursors by their current records, and equal records by run. */
+   retval = cursor1->compare(&cursor1->buffer[cursor1->pos * cursor1->esize],
+                             &cursor2->buffer[cursor2->pos * cursor2->esize]);
+
+   if (retval == 0)
+      retval = cursor1->run < cursor2->run ? -1 : cursor1->run > cursor2->run;
+
+   /* The top of the heap is the least record. */
+   return -retval;
+}
+
+static int refill(ExtCursor *cursor, size_t capacity)
+{
+   /* Read the next records of the run into the buffer of the cursor. */
+   cursor->count = fread(cursor->buffer, cursor->esize, capacity, cursor->fp);
+   cursor->pos = 0;
+
+   return ferror(cursor->fp) ? -1 : 0;
+}
+
+static int merge(FILE **runs, int nruns, FILE *out, int esize, size_t memory,
+   int (*compare)(const void *key1, const void *key2))
+{
+   Heap heap;
+   ExtCursor *cursors, *cursor;
+   char *buffers, *output;
+   size_t capacity, count;
+   void *data;
+   int retval, i;
+
+   /* Share the memory between a read buffer for each run and the write buffer. */
+   capacity = memory / esize / (nruns + 1);
+
+   if (capacity == 0)
+      capacity = 1;
+
+   cursors = (ExtCursor *)malloc(nruns * sizeof(ExtCursor));
+   buffers = (char *)malloc(capacity * esize * (nruns + 1));
+
+   heap_init(&heap, compare_cursor, NULL);
+
+   if (cursors == NULL || buffers == NULL || heap_reserve(&heap, nruns) != 0) {
+      heap_destroy(&heap);
+      free(buffers);
+      free(cursors);
+      return -1;
+   }
+
+   output = &buffers[capacity * esize * nruns];
+   retval = 0;
+
+   /* Start a cursor at the first record of each run. */
+   for (i = 0; i < nruns && retval == 0; i++) {
+      cursor = &cursors[i];
+      cursor->fp = runs[i];
+      cursor->buffer = &buffers[capacity * esize * i];
+      cursor->run = i;
+      cursor->esize = esize;
+      cursor->compare = compare;
+
+      rewind(cursor->fp);
+
+      if (refill(cursor, capacity) != 0 || (cursor->count > 0 && heap_insert(&heap, cursor) != 0))
+         retval = -1;
+   }
+
+   /* Repeatedly move the least current record to the output, and advance its cursor. */
+   count = 0;
+
+   while (retval == 0 && heap_extract(&heap, &data) == 0) {
+      cursor = data;
+      memcpy(&output[count * esize], &cursor->buffer[cursor->pos * esize], esize);
+
+      if (++count == capacity) {
+         if (fwrite(output, esize, count, out) != count)
+            retval = -1;
+
+         count = 0;
+      }
+
+      if (++cursor->pos == cursor->count && refill(cursor, capacity) != 0)
+         retval = -1;
+      else if (cursor->count > 0 && heap_insert(&heap, cursor) != 0)
+         retval = -1;
+   }
+
+   if (retval == 0 && fwrite(output, esize, count, out) != count)
+      retval = -1;
+
+   /* Free the storage allocated for merging. */
+   heap_destroy(&heap);
+   free(buffers);
+   free(cursors);
+
+   return retval;
+}
+
+static int make_runs(FILE *in, FILE *out, int esize, size_t capacity,
+   int (*compare)(const void *key1, const void *key2), FILE ***runs, int *nruns)
+{
+   FILE **temp, *fp;
+   char *buffer;
+   size_t count;
+   int max_runs = 0;
+
+   if ((buffer = (char *)malloc(capacity * esize)) == NULL)
+      return -1;
+
+   /* Sort the records a chunk at a time. */
+   while ((count = fread(buffer, esize, capacity, in)) > 0) {
+      if (qksort(buffer, (int)count, esize, 0, (int)count - 1, compare) != 0)
+         break;
+
+      /* Write the records straight to the output when they all fit in the first chunk. */
+      if (*nruns == 0 && count < capacity && feof(in)) {
+         count = fwrite(buffer, esize, count, out) - count;
+         free(buffer);
+         return count == 0 ? 1 : -1;
+      }
+
+      /* Otherwise write the chunk to a temporary file as a sorted run. */
+      if (*nruns == max_runs) {
+         max_runs = max_runs == 0 ? 16 : max_runs * 2;
+
+         if ((temp = (FILE **)realloc(*runs, max_runs * sizeof(FILE *))) == NULL)
+            break;
+
+         *runs = temp;
+      }
+
+      if ((fp = tmpfile()) == NULL)
+         break;
+
+      (*runs)[(*nruns)++] = fp;
+
+      if (fwrite(buffer, esize, count, fp) != count)
+         break;
+   }
+
+   /* Release the chunk before the merge buffers are allocated. */
+   free(buffer);
+
+   return count > 0 || ferror(in) ? -1 : 0;
+}
+
+static int merge_pass(FILE **runs, int *nruns, int fanin, int esize, size_t memory,
+   int (*compare)(const void *key1, const void *key2))
+{
+   FILE *fp;
+   int merged, group, i, j;
+
+   /* Merge each group of fanin runs into a single run, in place at the front of runs. */
+   for (i = 0, merged = 0; i < *nruns; i += group, merged++) {
+      group = *nruns - i < fanin ? *nruns - i : fanin;
+
+      if (group == 1) {
+         runs[merged] = runs[i];
+         continue;
+      }
+
+      if ((fp = tmpfile()) == NULL || merge(&runs[i], group, fp, esize, memory, compare) != 0) {
+         if (fp != NULL)
+            fclose(fp);
+
+         /* Keep the runs not merged yet behind those merged so far, so that all can be closed. */
+         memmove(&runs[merged], &runs[i], (*nruns - i) * sizeof(FILE *));
+         *nruns = merged + *nruns - i;
+         return -1;
+      }
+
+      for (j = i; j < i + group; j++)
+         fclose(runs[j]);
+
+      runs[merged] = fp;
+   }
+
+   *nruns = merged;
+
+   return 0;
+}
+
+static void close_runs(FILE **runs, int nruns)
+{
+   int i;
+
+   /* Close the runs, which deletes the temporary files. */
+   for (i = 0; i < nruns; i++)
+      fclose(runs[i]);
+
+   free(runs);
+}
+
+int extsort(FILE *in, FILE *out, int esize, size_t memory, int fanin,
+            int (*compare)(const void *key1, const void *key2))
+{
+   FILE **runs = NULL;
+   size_t capacity, blocks;
+   int nruns = 0, retval;
+
+   /* Hold as many records in memory as fit, but no more than qksort can sort. */
+   if (esize <= 0 || memory / esize < 3)
+      return -1;
+
+   capacity = memory / esize;
+
+   if (capacity > INT_MAX)
+      capacity = INT_MAX;
+
+   /* Derive the fan-in from the memory available when it is not given. */
+   if (fanin == 0) {
+      blocks = memory / EXTSORT_MIN_BUFFER;
+      fanin = blocks > INT_MAX ? INT_MAX : (int)blocks - 1;
+   }
+
+   /* Leave room for at least one record in the buffer of each run and in the write buffer. */
+   if (fanin < 2)
+      fanin = 2;
+
+   if ((size_t)fanin > capacity - 1)
+      fanin = (int)(capacity - 1);
+
+   /* Sort the records into runs, unless they all fit in memory at once. */
+   if ((retval = make_runs(in, out, esize, capacity, compare, &runs, &nruns)) != 0) {
+      close_runs(runs, nruns);
+      return retval > 0 && !ferror(out) ? 0 : -1;
+   }
+
+   /* Merge groups of runs into longer runs until they can be merged in one pass. */
+   while (nruns > fanin && retval == 0)
+      retval = merge_pass(runs, &nruns, fanin, esize, memory, compare);
+
+   /* Merge the last runs into the output. */
+   if (retval == 0 && nruns > 0)
+      retval = merge(runs, nruns, out, esize, memory, compare);
+
+   close_runs(runs, nruns);
+
+   return retval == 0 && !ferror(out) ? 0 : -1;
+}
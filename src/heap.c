@@ -5,6 +5,7 @@
  * @brief Implementation of the Heap Abstract Datatype
  */
 
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -14,11 +15,81 @@
  * Define private macros used by the heap implementation.
  */
 
-#define heap_parent(npos) ((int) (((npos) - 1)/2))
+#define heap_parent(heap, npos) ((int) (((npos) - 1)/(heap)->arity))
 
-#define heap_left(npos) ((int) (((npos) * 2) + 1))
+#define heap_child(heap, npos) ((int) (((npos) * (heap)->arity) + 1))
 
-#define heap_right(npos) ((int) (((npos) * 2) + 2))
+/*
+ * Define the smallest capacity allocated for a heap that is not empty.
+ */
+
+#define HEAP_MIN_CAPACITY 16
+
+static int resize(Heap *heap, int capacity)
+{
+    void **tree;
+
+    if (capacity == 0)
+    {
+        /* Release the storage of an empty heap. */
+        free(heap->tree);
+        heap->tree = NULL;
+        heap->capacity = 0;
+        return 0;
+    }
+
+    /* Adjust the storage used by the heap. */
+    if ((tree = (void **)realloc(heap->tree, capacity * sizeof(void *))) == NULL)
+        return -1;
+
+    heap->tree = tree;
+    heap->capacity = capacity;
+
+    return 0;
+}
+
+static void sift_down(Heap *heap, int ipos)
+{
+    void *temp;
+
+    int cpos, lpos, mpos;
+
+    /* Push the contents of the node at ipos downward until the heap property holds. */
+    while (1)
+    {
+        /* Select the child to swap with the current node among all its children. */
+        mpos = ipos;
+        cpos = heap_child(heap, ipos);
+        lpos = cpos + heap->arity;
+
+        if (lpos > heap_size(heap))
+            lpos = heap_size(heap);
+
+        for (; cpos < lpos; cpos++)
+        {
+            if (heap->compare(heap->tree[cpos], heap->tree[mpos]) > 0)
+                mpos = cpos;
+        }
+
+        /* When mpos is ipos, the heap property has been restored. */
+        if (mpos == ipos)
+        {
+            break;
+        }
+        else
+        {
+            /* Swap the contents of the current node and the selected child. */
+            temp = heap->tree[mpos];
+            heap->tree[mpos] = heap->tree[ipos];
+            heap->tree[ipos] = temp;
+
+            /* Move down one level in the tree to continue heapifying. */
+            ipos = mpos;
+        }
+    }
+
+    return;
+}
 
 void heap_init(Heap *heap, int (*compare)(const void *key1, const void *key2), 
                void (*destroy)(void *data))
@@ -28,6 +99,18 @@ void heap_init(Heap *heap, int (*compare)(const void *key1, const void *key2),
     heap->compare = compare;
     heap->destroy = destroy;
     heap->tree = NULL;
+    heap->capacity = 0;
+    heap->arity = 2;
+
+    return;
+}
+
+void heap_init_arity(Heap *heap, int arity, int (*compare)(const void *key1, const void *key2),
+                     void (*destroy)(void *data))
+{
+    /* Initialize the heap, with at least two children per node. */
+    heap_init(heap, compare, destroy);
+    heap->arity = arity > 2 ? arity : 2;
 
     return;
 }
@@ -61,14 +144,14 @@ int heap_insert(Heap *heap, const void *data)
 
     int ipos, ppos;
 
-    /* Allocate storage for the node. */
-    if ((temp = (void **)realloc(heap->tree, (heap_size(heap) + 1) * sizeof(void *))) == NULL)
-    {
-        return -1;
-    }
-    else
+    /* Double the storage for the nodes when the heap is full. */
+    if (heap_size(heap) == heap->capacity)
     {
-        heap->tree = temp;
+        if (heap->capacity > INT_MAX / 2)
+            return -1;
+
+        if (resize(heap, heap->capacity == 0 ? HEAP_MIN_CAPACITY : heap->capacity * 2) != 0)
+            return -1;
     }
 
     /* Insert the node after the last node. */
@@ -76,7 +159,7 @@ int heap_insert(Heap *heap, const void *data)
 
     /* Heapify the tree by pushing the contents of the new node upward. */
     ipos = heap_size(heap);
-    ppos = heap_parent(ipos);
+    ppos = heap_parent(heap, ipos);
 
     while (ipos > 0 && heap->compare(heap->tree[ppos], heap->tree[ipos]) < 0)
     {
@@ -87,7 +170,7 @@ int heap_insert(Heap *heap, const void *data)
 
         /* Move up one level in the tree to continue heapifying */
         ipos = ppos;
-        ppos = heap_parent(ipos);
+        ppos = heap_parent(heap, ipos);
     }
 
     /* Adjust the size of the heap to account for the inserted node */
@@ -97,9 +180,7 @@ int heap_insert(Heap *heap, const void *data)
 
 int heap_extract(Heap *heap, void **data)
 {
-    void *save, *temp;
-
-    int ipos, lpos, rpos, mpos;
+    void *save;
 
     /* Do not allow extraction from an empty heap. */
     if (heap_size(heap) == 0)
@@ -108,78 +189,61 @@ int heap_extract(Heap *heap, void **data)
     /* Extract the node at the top of the heap */
     *data = heap->tree[0];
 
-    /* Adjust the storage used by the heap. */
+    /* Adjust the size of the heap to account for the extracted node. */
     save = heap->tree[heap_size(heap) - 1];
+    heap->size--;
 
-    if (heap_size(heap) - 1 > 0)
-    {
-        if ((temp = (void **)realloc(heap->tree, (heap_size(heap) - 1) * sizeof(void *))) == NULL)
-        {
-            return -1;
-        }
-        else
-        {
-            heap->tree = temp;
-        }
-
-        /* Adjust the size of the heap to account for the extracted node. */
-        heap->size--;
-    }
-    else
-    {
-        /* Manage the heap when extracting the last node. */
+    /* 
+     * Halve the storage used by the heap once it is a quarter full, which keeps alternating
+     * insertions and extractions from reallocating. A failure to shrink is not an error.
+     */
+    if (heap_size(heap) < heap->capacity / 4 && heap->capacity / 2 >= HEAP_MIN_CAPACITY)
+        resize(heap, heap->capacity / 2);
 
-        free(heap->tree);
-        heap->tree = NULL;
-        heap->size = 0;
+    /* Manage the heap when extracting the last node. */
+    if (heap_size(heap) == 0)
         return 0;
-    }
 
     /* Copy the last node to the top. */
     heap->tree[0] = save;
 
     /* Heapify the tree by pushing the contents of the new top downward. */
+    sift_down(heap, 0);
 
-    ipos = 0;
-    lpos = heap_left(ipos);
-    rpos = heap_right(ipos);
+    return 0;
+}
 
-    while (1)
-    {
-        /* Select the child to swap with the current node. */
-        lpos = heap_left(ipos);
-        rpos = heap_right(ipos);
+int heap_reserve(Heap *heap, int capacity)
+{
+    /* Do nothing if the heap can already hold capacity nodes. */
+    if (capacity <= heap->capacity)
+        return 0;
 
-        if (lpos < heap_size(heap) && heap->compare(heap->tree[lpos], heap->tree[ipos]) > 0)
-        {
-            mpos = lpos;
-        }
-        else
-        {
-            mpos = ipos;
-        }
+    return resize(heap, capacity);
+}
 
-        if (rpos < heap_size(heap) && heap->compare(heap->tree[rpos], heap->tree[mpos]) > 0)
-        {
-            mpos = rpos;
-        }
+int heap_shrink_to_fit(Heap *heap)
+{
+    /* Reduce the storage used by the heap to its number of nodes. */
+    if (heap_size(heap) == heap->capacity)
+        return 0;
 
-        /* When mpos is ipos, the heap property has been restored. */
-        if (mpos == ipos)
-        {
-            break;
-        }
-        else
-        {
-            /* Swap the contents of the current node and the selected child. */
-            temp = heap->tree[mpos];
-            heap->tree[mpos] = heap->tree[ipos];
-            heap->tree[ipos] = temp;
+    return resize(heap, heap_size(heap));
+}
 
-            /* Move down one level in the tree to continue heapifying. */
-            ipos = mpos;
+int heap_build(Heap *heap, void **data, int size)
+{
+    int ipos;
+
+    /* Release any storage held by the heap and adopt the array of nodes. */
+    free(heap->tree);
+    heap->tree = data;
+    heap->size = size;
+    heap->capacity = size;
+
+    /* Heapify the tree bottom-up, pushing down each node that has children. */
+    for (ipos = size > 1 ? heap_parent(heap, size - 1) : -1; ipos >= 0; ipos--)
+        sift_down(heap, ipos);
 
-        }
-    }
     return 0;
 }
@@ -0,0 +1,55 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "sort.h"
+
+static void swap(char *a, char *b, int esize)
+{
+   char temp;
+
+   /* Exchange two elements byte by byte, so no storage is needed. */
+   while (esize-- > 0) {
+      temp = *a;
+      *a++ = *b;
+      *b++ = temp;
+   }
+}
+
+static void sift_down(char *a, int esize, int ipos, int size, int (*compare)(const void *key1, const void *key2))
+{
+   int lpos, mpos;
+
+   /* Push the element at ipos down until it is not less than its children. */
+   while ((lpos = (ipos * 2) + 1) < size) {
+      /* Select the greater child. */
+      mpos = lpos;
+
+      if (lpos + 1 < size && compare(&a[(lpos + 1) * esize], &a[lpos * esize]) > 0)
+         mpos = lpos + 1;
+
+      /* Stop when the heap property has been restored. */
+      if (compare(&a[mpos * esize], &a[ipos * esize]) <= 0)
+         break;
+
+      swap(&a[mpos * esize], &a[ipos * esize], esize);
+      ipos = mpos;
+   }
+}
+
+int hpsort(void *data, int size, int esize, int (*compare)(const void *key1, const void *key2))
+{
+   char *a = data;
+   int i;
+
+   /* Build a heap bottom-up so that the greatest element is at the top. */
+   for (i = size / 2 - 1; i >= 0; i--)
+      sift_down(a, esize, i, size, compare);
+
+   /* Repeatedly move the top of the heap behind the elements still in the heap. */
+   for (i = size - 1; i > 0; i--) {
+      swap(&a[0], &a[i * esize], esize);
+      sift_down(a, esize, 0, i, compare);
+   }
+
+   return 0;
+}
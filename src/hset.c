@@ -0,0 +1,141 @@
+/* Implementation of the Hashed Set Abstract Datatype */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "chtbl.h"
+#include "hset.h"
+
+/*
+ * Define a private macro for the number of buckets to scan, including those of an old table still
+ * being migrated by the hash table.
+ */
+
+#define hset_buckets(set) ((set)->buckets + (set)->old_buckets)
+
+static const List *bucket_at(const HSet *set, int bucket)
+{
+    /* The buckets still being migrated follow the buckets of the table. */
+    if (bucket < set->buckets)
+        return &set->table[bucket];
+    else
+        return &set->old_table[bucket - set->buckets];
+}
+
+static int insert_all(HSet *set, const HSet *from, const HSet *other,
+    int keep)
+{
+    ListElmt *member;
+    int bucket;
+
+    /* 
+     * Insert the members of from whose membership in other equals
+     * keep, or every member when other is NULL.
+     */
+    for (bucket = 0; bucket < hset_buckets(from); bucket++)
+    {
+        for (member = list_head(bucket_at(from, bucket)); member != NULL;
+            member = list_next(member))
+        {
+            if (other != NULL && 
+                hset_is_member(other, list_data(member)) != keep)
+                continue;
+
+            if (hset_insert(set, list_data(member)) < 0)
+                return -1;
+        }
+    }
+
+    return 0;
+}
+
+int hset_union(HSet *setu, const HSet *set1, const HSet *set2)
+{
+    /* Initialize the set for the union. */
+    if (hset_init(setu, set1->buckets > set2->buckets ? set1->buckets :
+        set2->buckets, set1->h, set1->match, NULL) != 0)
+        return -1;
+
+    /* Insert the members of both sets, skipping duplicates. */
+    if (insert_all(setu, set1, NULL, 0) != 0 ||
+        insert_all(setu, set2, NULL, 0) != 0)
+    {
+        hset_destroy(setu);
+        return -1;
+    }
+
+    return 0;
+}
+
+int hset_intersection(HSet *seti, const HSet *set1, const HSet *set2)
+{
+    /* Initialize the set for the intersection. */
+    if (hset_init(seti, set1->buckets, set1->h, set1->match, NULL) != 0)
+        return -1;
+
+    /* Insert the members present in both sets. */
+    if (insert_all(seti, set1, set2, 1) != 0)
+    {
+        hset_destroy(seti);
+        return -1;
+    }
+
+    return 0;
+}
+
+int hset_difference(HSet *setd, const HSet *set1, const HSet *set2)
+{
+    /* Initialize the set for the difference. */
+    if (hset_init(setd, set1->buckets, set1->h, set1->match, NULL) != 0)
+        return -1;
+
+    /* Insert the members in set1 not in set2. */
+    if (insert_all(setd, set1, set2, 0) != 0)
+    {
+        hset_destroy(setd);
+        return -1;
+    }
+
+    return 0;
+}
+
+int hset_is_member(const HSet *set, const void *data)
+{
+    void *temp = (void *)data;
+
+    /* Determine if the data is a member of the set. */
+    return chtbl_lookup(set, &temp) == 0;
+}
+
+int hset_is_subset(const HSet *set1, const HSet *set2)
+{
+    ListElmt *member;
+    int bucket;
+
+    /* Do a quick test to rule out some cases */
+    if (hset_size(set1) > hset_size(set2))
+        return 0;
+
+    /* Determine if set1 is a subset of set2 */
+    for (bucket = 0; bucket < hset_buckets(set1); bucket++)
+    {
+        for (member = list_head(bucket_at(set1, bucket)); member != NULL;
+            member = list_next(member))
+        {
+            if (!hset_is_member(set2, list_data(member)))
+                return 0;
+        }
+    }
+
+    return 1;
+}
+
+int hset_is_equal(const HSet *set1, const HSet *set2)
+{
+    /* Do a quick test to rule out some cases */
+    if (hset_size(set1) != hset_size(set2))
+        return 0;
+
+    /* Sets of the same size are equal if they are subsets */
+    return hset_is_subset(set1, set2);
+}
@@ -0,0 +1,244 @@
+/**
+ * @file iheap.c
+ * @date 16 October 2026
+ * @brief Implementation of the Indexed Heap Abstract Datatype
+ */
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "iheap.h"
+
+/* 
+ * Define private macros used by the indexed heap implementation.
+ */
+
+#define iheap_parent(npos) ((int) (((npos) - 1)/2))
+
+#define iheap_left(npos) ((int) (((npos) * 2) + 1))
+
+#define iheap_right(npos) ((int) (((npos) * 2) + 2))
+
+#define iheap_key(heap, npos) ((heap)->data[(heap)->tree[(npos)]])
+
+static int grow(IHeap *heap)
+{
+    int *tree, *position;
+    void **data;
+    int capacity;
+
+    if (heap->capacity > INT_MAX / 2)
+        return -1;
+
+    capacity = heap->capacity == 0 ? 16 : heap->capacity * 2;
+
+    /* Double the storage of each array, keeping those already reallocated on failure. */
+    if ((tree = (int *)realloc(heap->tree, capacity * sizeof(int))) == NULL)
+        return -1;
+
+    heap->tree = tree;
+
+    if ((data = (void **)realloc(heap->data, capacity * sizeof(void *))) == NULL)
+        return -1;
+
+    heap->data = data;
+
+    if ((position = (int *)realloc(heap->position, capacity * sizeof(int))) == NULL)
+        return -1;
+
+    heap->position = position;
+    heap->capacity = capacity;
+
+    return 0;
+}
+
+static void place(IHeap *heap, int npos, int handle)
+{
+    /* Store the handle at a position in the tree and remember where it is. */
+    heap->tree[npos] = handle;
+    heap->position[handle] = npos;
+
+    return;
+}
+
+static void sift_up(IHeap *heap, int ipos)
+{
+    int handle, ppos;
+
+    /* Move the handle up while its parent compares lower, shifting the parents down. */
+    handle = heap->tree[ipos];
+
+    while (ipos > 0)
+    {
+        ppos = iheap_parent(ipos);
+
+        if (heap->compare(iheap_key(heap, ppos), heap->data[handle]) >= 0)
+            break;
+
+        place(heap, ipos, heap->tree[ppos]);
+        ipos = ppos;
+    }
+
+    place(heap, ipos, handle);
+
+    return;
+}
+
+static void sift_down(IHeap *heap, int ipos)
+{
+    int handle, lpos, rpos, mpos;
+
+    /* Move the handle down while a child compares higher, shifting the children up. */
+    handle = heap->tree[ipos];
+
+    while (1)
+    {
+        lpos = iheap_left(ipos);
+        rpos = iheap_right(ipos);
+
+        if (lpos >= heap->size)
+            break;
+
+        mpos = lpos;
+
+        if (rpos < heap->size && heap->compare(iheap_key(heap, rpos), iheap_key(heap, lpos)) > 0)
+            mpos = rpos;
+
+        if (heap->compare(iheap_key(heap, mpos), heap->data[handle]) <= 0)
+            break;
+
+        place(heap, ipos, heap->tree[mpos]);
+        ipos = mpos;
+    }
+
+    place(heap, ipos, handle);
+
+    return;
+}
+
+void iheap_init(IHeap *heap, int (*compare)(const void *key1, const void *key2),
+                void (*destroy)(void *data))
+{
+    /* Initialize the heap. */
+    heap->size = 0;
+    heap->compare = compare;
+    heap->destroy = destroy;
+    heap->tree = NULL;
+    heap->data = NULL;
+    heap->position = NULL;
+    heap->handles = 0;
+    heap->capacity = 0;
+
+    return;
+}
+
+void iheap_destroy(IHeap *heap)
+{
+    int i;
+
+    /* Remove all the nodes from the heap */
+    if (heap->destroy != NULL)
+    {
+        for (i = 0; i < iheap_size(heap); i++)
+        {
+            /* Call a user-defined function to free dynamically allocated data. */
+            heap->destroy(iheap_key(heap, i));
+        }
+    }
+
+    /* Free the storage allocated for the heap */
+    free(heap->tree);
+    free(heap->data);
+    free(heap->position);
+
+    /* No operations are allowed now, but clear the structure as a precaution. */
+    memset(heap, 0, sizeof(IHeap));
+
+    return;
+}
+
+int iheap_insert(IHeap *heap, const void *data, int *handle)
+{
+    int new_handle;
+
+    /* 
+     * Reuse the free handle stored just after the last node, or issue a new handle. Either way the
+     * handle ends up right after the last node.
+     */
+    if (heap->size < heap->handles)
+    {
+        new_handle = heap->tree[heap->size];
+    }
+    else
+    {
+        if (heap->handles == heap->capacity && grow(heap) != 0)
+            return -1;
+
+        new_handle = heap->handles++;
+        heap->tree[heap->size] = new_handle;
+    }
+
+    /* Insert the node after the last node and heapify it upward. */
+    heap->data[new_handle] = (void *)data;
+    heap->position[new_handle] = heap->size;
+    heap->size++;
+    sift_up(heap, heap->size - 1);
+
+    if (handle != NULL)
+        *handle = new_handle;
+
+    return 0;
+}
+
+int iheap_remove(IHeap *heap, int handle, void **data)
+{
+    int ipos, last;
+
+    /* Do not allow removal of a node that is not in the heap. */
+    if (!iheap_is_member(heap, handle))
+        return -1;
+
+    *data = heap->data[handle];
+    ipos = heap->position[handle];
+
+    /* Move the last node into the vacated position and keep the freed handle after the nodes. */
+    heap->size--;
+    last = heap->tree[heap->size];
+    heap->tree[heap->size] = handle;
+    heap->position[handle] = -1;
+
+    if (ipos < heap->size)
+    {
+        place(heap, ipos, last);
+
+        /* Heapify the moved node in whichever direction restores the heap property. */
+        sift_up(heap, ipos);
+        sift_down(heap, heap->position[last]);
+    }
+
+    return 0;
+}
+
+int iheap_extract(IHeap *heap, void **data)
+{
+    /* Do not allow extraction from an empty heap. */
+    if (iheap_size(heap) == 0)
+        return -1;
+
+    return iheap_remove(heap, heap->tree[0], data);
+}
+
+int iheap_update(IHeap *heap, int handle, const void *data)
+{
+    /* Do not allow updating a node that is not in the heap. */
+    if (!iheap_is_member(heap, handle))
+        return -1;
+
+    /* Replace the data and heapify the node in whichever direction is needed. */
+    heap->data[handle] = (void *)data;
+    sift_up(heap, heap->position[handle]);
+    sift_down(heap, heap->position[handle]);
+
+    return 0;
+}
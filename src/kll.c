@@ -0,0 +1,353 @@
+/**
+ * @file kll.c
+ * @date 16 October 2026
+ * @brief Implementation of the KLL Quantile Sketch Abstract Datatype
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "kll.h"
+#include "sort.h"
+
+/*
+ * Define the smallest k, and the factor by which capacities shrink from one level to the next.
+ */
+
+#define KLL_MIN_K 8
+#define KLL_SHRINK (2.0 / 3.0)
+
+/* Define a structure pairing a value kept with the number of values it stands for. */
+typedef struct KLLItem_ {
+    double value;
+    long long weight;
+} KLLItem;
+
+static int compare_double(const void *key1, const void *key2)
+{
+    double a = *(const double *)key1, b = *(const double *)key2;
+
+    return a < b ? -1 : a > b;
+}
+
+static int compare_item(const void *key1, const void *key2)
+{
+    return compare_double(&((const KLLItem *)key1)->value, &((const KLLItem *)key2)->value);
+}
+
+static uint64_t next_random(KLL *kll)
+{
+    /* Advance the xorshift generator. */
+    kll->state ^= kll->state << 13;
+    kll->state ^= kll->state >> 7;
+    kll->state ^= kll->state << 17;
+
+    return kll->state;
+}
+
+static int level_capacity(const KLL *kll, int h)
+{
+    double capacity = kll->k;
+    int i;
+
+    /* Shrink the capacity by a constant factor for each level below the top. */
+    for (i = h; i < kll->levels - 1; i++)
+        capacity *= KLL_SHRINK;
+
+    return (int)capacity + 1 > 2 ? (int)capacity + 1 : 2;
+}
+
+static int add_level(KLL *kll)
+{
+    double **items;
+    int *counts, *capacities;
+    int max_levels, h;
+
+    /* Double the storage for the levels when it is full. */
+    if (kll->levels == kll->max_levels)
+    {
+        max_levels = kll->max_levels == 0 ? 8 : kll->max_levels * 2;
+
+        if ((items = (double **)realloc(kll->items, max_levels * sizeof(double *))) == NULL)
+            return -1;
+
+        kll->items = items;
+
+        if ((counts = (int *)realloc(kll->counts, max_levels * sizeof(int))) == NULL)
+            return -1;
+
+        kll->counts = counts;
+
+        if ((capacities = (int *)realloc(kll->capacities, max_levels * sizeof(int))) == NULL)
+            return -1;
+
+        kll->capacities = capacities;
+        kll->max_levels = max_levels;
+    }
+
+    /* Add an empty level at the top, which lowers the capacities of the levels below. */
+    kll->items[kll->levels] = NULL;
+    kll->counts[kll->levels] = 0;
+    kll->capacities[kll->levels] = 0;
+    kll->levels++;
+
+    for (h = 0, kll->max_kept = 0; h < kll->levels; h++)
+        kll->max_kept += level_capacity(kll, h);
+
+    return 0;
+}
+
+static int append(KLL *kll, int h, const double *values, int count)
+{
+    double *items;
+    int capacity;
+
+    if (count == 0)
+        return 0;
+
+    /* Grow the storage of the level to hold the values. */
+    if (kll->counts[h] + count > kll->capacities[h])
+    {
+        capacity = kll->capacities[h] == 0 ? 16 : kll->capacities[h];
+
+        while (capacity < kll->counts[h] + count)
+            capacity *= 2;
+
+        if ((items = (double *)realloc(kll->items[h], capacity * sizeof(double))) == NULL)
+            return -1;
+
+        kll->items[h] = items;
+        kll->capacities[h] = capacity;
+    }
+
+    memcpy(&kll->items[h][kll->counts[h]], values, count * sizeof(double));
+    kll->counts[h] += count;
+    kll->kept += count;
+
+    return 0;
+}
+
+static int compact(KLL *kll, int h)
+{
+    double *items;
+    int count, odd, i, j;
+
+    if (h == kll->levels - 1 && add_level(kll) != 0)
+        return -1;
+
+    /* Sort the level, leaving aside its greatest value when the number of values is odd. */
+    items = kll->items[h];
+    count = kll->counts[h];
+    odd = count % 2;
+
+    if (qksort(items, count, sizeof(double), 0, count - 1, compare_double) != 0)
+        return -1;
+
+    /* Keep every other value, starting at random, in place at the front of the level. */
+    for (i = (int)(next_random(kll) & 1), j = 0; i < count - odd; i += 2, j++)
+        items[j] = items[i];
+
+    /* Move the values kept to the level above, where each stands for twice as many values. */
+    if (append(kll, h + 1, items, j) != 0)
+        return -1;
+
+    if (odd)
+        items[0] = items[count - 1];
+
+    kll->counts[h] = odd;
+    kll->kept -= count - odd;
+
+    return 0;
+}
+
+static int compress(KLL *kll)
+{
+    int h;
+
+    /* Compact the lowest level over its capacity until the sketch is no longer full. */
+    while (kll->kept >= kll->max_kept)
+    {
+        for (h = 0; h < kll->levels; h++)
+        {
+            if (kll->counts[h] >= level_capacity(kll, h))
+                break;
+        }
+
+        if (compact(kll, h) != 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+int kll_init(KLL *kll, int k)
+{
+    /* Initialize the sketch with a single level. */
+    kll->size = 0;
+    kll->k = k > KLL_MIN_K ? k : KLL_MIN_K;
+    kll->levels = 0;
+    kll->max_levels = 0;
+    kll->items = NULL;
+    kll->counts = NULL;
+    kll->capacities = NULL;
+    kll->kept = 0;
+    kll->max_kept = 0;
+    kll->min = 0.0;
+    kll->max = 0.0;
+    kll->state = UINT64_C(0x9E3779B97F4A7C15);
+
+    if (add_level(kll) != 0)
+    {
+        kll_destroy(kll);
+        return -1;
+    }
+
+    return 0;
+}
+
+void kll_destroy(KLL *kll)
+{
+    int h;
+
+    /* Free the storage allocated for the levels. */
+    for (h = 0; h < kll->levels; h++)
+        free(kll->items[h]);
+
+    free(kll->items);
+    free(kll->counts);
+    free(kll->capacities);
+
+    /* No operations are allowed now, but clear the structure as a precaution. */
+    memset(kll, 0, sizeof(KLL));
+
+    return;
+}
+
+int kll_insert(KLL *kll, double value)
+{
+    /* Insert the value at the bottom level. */
+    if (append(kll, 0, &value, 1) != 0)
+        return -1;
+
+    /* Track the least and greatest values exactly. */
+    if (kll->size == 0 || value < kll->min)
+        kll->min = value;
+
+    if (kll->size == 0 || value > kll->max)
+        kll->max = value;
+
+    kll->size++;
+
+    return compress(kll);
+}
+
+int kll_merge(KLL *kll, const KLL *other)
+{
+    int h;
+
+    if (kll == other)
+        return -1;
+
+    /* Append the values of each level to the same level. */
+    for (h = 0; h < other->levels; h++)
+    {
+        while (h >= kll->levels)
+        {
+            if (add_level(kll) != 0)
+                return -1;
+        }
+
+        if (append(kll, h, other->items[h], other->counts[h]) != 0)
+            return -1;
+    }
+
+    if (other->size > 0)
+    {
+        if (kll->size == 0 || other->min < kll->min)
+            kll->min = other->min;
+
+        if (kll->size == 0 || other->max > kll->max)
+            kll->max = other->max;
+    }
+
+    kll->size += other->size;
+
+    return compress(kll);
+}
+
+int kll_quantile(const KLL *kll, double q, double *value)
+{
+    KLLItem *items;
+    long long weight;
+    double target;
+    int h, i, n;
+
+    if (kll->size == 0 || !(q >= 0.0 && q <= 1.0))
+        return -1;
+
+    /* The extreme quantiles are known exactly. */
+    if (q == 0.0 || q == 1.0)
+    {
+        *value = q == 0.0 ? kll->min : kll->max;
+        return 0;
+    }
+
+    /* Gather the values kept with their weights, and sort them. */
+    if ((items = (KLLItem *)malloc(kll->kept * sizeof(KLLItem))) == NULL)
+        return -1;
+
+    for (h = 0, n = 0; h < kll->levels; h++)
+    {
+        for (i = 0; i < kll->counts[h]; i++, n++)
+        {
+            items[n].value = kll->items[h][i];
+            items[n].weight = (long long)1 << h;
+        }
+    }
+
+    if (qksort(items, n, sizeof(KLLItem), 0, n - 1, compare_item) != 0)
+    {
+        free(items);
+        return -1;
+    }
+
+    /* Find the value whose weight brings the rank past the quantile. */
+    target = q * (double)(kll->size - 1);
+    *value = items[n - 1].value;
+
+    for (i = 0, weight = 0; i < n; i++)
+    {
+        weight += items[i].weight;
+
+        if ((double)weight > target)
+        {
+            *value = items[i].value;
+            break;
+        }
+    }
+
+    free(items);
+
+    return 0;
+}
+
+double kll_rank(const KLL *kll, double value)
+{
+    long long weight = 0;
+    int h, i;
+
+    if (kll->size == 0)
+        return 0.0;
+
+    /* Add up the weights of the values kept that are less than or equal to value. */
+    for (h = 0; h < kll->levels; h++)
+    {
+        for (i = 0; i < kll->counts[h]; i++)
+        {
+            if (kll->items[h][i] <= value)
+                weight += (long long)1 << h;
+        }
+    }
+
+    return (double)weight / (double)kll->size;
+}
@@ -5,6 +5,56 @@
 
 #include "list.h"
 
+static ListElmt *alloc_elmt(List *list)
+{
+   ListChunk *chunk;
+   ListElmt *element;
+   int i;
+
+   /* Allocate elements one by one when the list is not pooled. */
+   if (list->chunk_size == 0)
+      return (ListElmt*)malloc(sizeof(ListElmt));
+
+   if (list->free_elmts == NULL)
+   {
+      /* Carve a new chunk of elements into the free list. */
+      if ((chunk = (ListChunk*)malloc(sizeof(ListChunk) + 
+         list->chunk_size * sizeof(ListElmt))) == NULL)
+         return NULL;
+
+      chunk->next = list->chunks;
+      list->chunks = chunk;
+
+      for (i = list->chunk_size - 1; i >= 0; i--)
+      {
+         chunk->elmts[i].next = list->free_elmts;
+         list->free_elmts = &chunk->elmts[i];
+      }
+   }
+
+   /* Take the first element from the free list. */
+   element = list->free_elmts;
+   list->free_elmts = element->next;
+
+   return element;
+}
+
+static void free_elmt(List *list, ListElmt *element)
+{
+   if (list->chunk_size == 0)
+   {
+      free(element);
+   }
+   else
+   {
+      /* Keep the element in the free list for later insertions. */
+      element->next = list->free_elmts;
+      list->free_elmts = element;
+   }
+
+   return;
+}
+
 void list_init(List *list, void(*destroy)(void *data))
 {
    /* Initialize the list. */
@@ -12,14 +62,53 @@ void list_init(List *list, void(*destroy)(void *data))
    list->destroy = destroy;
    list->head = NULL;
    list->tail = NULL;
+   list->chunk_size = 0;
+   list->free_elmts = NULL;
+   list->chunks = NULL;
+
+   return;
+}
+
+void list_init_pooled(List *list, int chunk_size, 
+   void (*destroy)(void *data))
+{
+   /* Initialize the list and its pool of elements. */
+   list_init(list, destroy);
+   list->chunk_size = chunk_size > 0 ? chunk_size : LIST_CHUNK_SIZE;
 
    return;
 }
 
 void list_destroy(List *list)
 {
+   ListElmt *element;
+   ListChunk *chunk;
    void *data;
 
+   if (list->chunk_size > 0)
+   {
+      /* 
+       * Call a user-defined function to free dynamically allocated
+       * data, then release all chunks of elements at once.
+       */
+      if (list->destroy != NULL)
+      {
+         for (element = list->head; element != NULL; 
+            element = element->next)
+            list->destroy(element->data);
+      }
+
+      while (list->chunks != NULL)
+      {
+         chunk = list->chunks;
+         list->chunks = chunk->next;
+         free(chunk);
+      }
+
+      memset(list, 0, sizeof(List));
+      return;
+   }
+
    /* Remove each element. */
    while (list_size(list) > 0)
    {
@@ -49,7 +138,7 @@ int list_ins_next(List *list, ListElmt *element, const void *data)
    ListElmt *new_element;
 
    /* Allocate storage for the element */
-   if ((new_element = (ListElmt*)malloc(sizeof(ListElmt))) == NULL)
+   if ((new_element = alloc_elmt(list)) == NULL)
       return -1;
    
    /* Insert the element into the list */
@@ -119,7 +208,7 @@ int list_rem_next(List *list, ListElmt *element, void **data)
    }
 
    /* Free the storage allocated by the abstract datatype. */
-   free(old_element);
+   free_elmt(list, old_element);
 
    /* 
     * Adjust the size of the list to account for the removed element.
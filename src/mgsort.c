@@ -3,10 +3,15 @@
 
 #include "sort.h"
 
-static int merge(void *data, int esize, int i, int j, int k, int (*compare)(const void *key1, const void *key2))
+/* Initial number of consecutive elements taken from one run before tmsort starts galloping. */
+#define TMSORT_MIN_GALLOP 7
+
+/* Maximum number of pending runs, enough for any int number of elements. */
+#define TMSORT_MAX_RUNS 85
+
+static void merge(void *data, char *m, int esize, int i, int j, int k, int (*compare)(const void *key1, const void *key2))
 {
    char *a = data;
-   char *m;
    int ipos, jpos, mpos;
 
    /* Initialize the counters used in merging. */
@@ -14,10 +19,6 @@ static int merge(void *data, int esize, int i, int j, int k, int (*compare)(cons
    jpos = j + 1;
    mpos = 0;
 
-   /* Allocate storage for the merged elements. */
-   if ((m = (char *) malloc(esize * ((k - i) + 1))) == NULL)
-      return -1;
-
    /* Continue while either division has elements to merge. */
    while (ipos <= j || jpos <= k) {
       if (ipos > j) {
@@ -38,8 +39,8 @@ static int merge(void *data, int esize, int i, int j, int k, int (*compare)(cons
          }
          continue;
       }
-      /* Append the next ordered element to the merged elements. */
-      if (compare(&a[ipos * esize], &a[jpos * esize]) < 0) {
+      /* Append the next ordered element to the merged elements, keeping equal ones in order. */
+      if (compare(&a[ipos * esize], &a[jpos * esize]) <= 0) {
          memcpy(&m[mpos * esize], &a[ipos * esize], esize);
          ipos++;
          mpos++;
@@ -53,14 +54,9 @@ static int merge(void *data, int esize, int i, int j, int k, int (*compare)(cons
 
    /* Prepare to pass back the merged data. */
    memcpy(&a[i * esize], m, esize * ((k - i) + 1));
-
-   /* Free the storage allocated for merging. */
-   free(m);
-   return 0;
-
 }
 
-int mgsort(void *data, int size, int esize, int i, int k, int (*compare)(const void *key1, const void *key2))
+static void divide(void *data, char *m, int esize, int i, int k, int (*compare)(const void *key1, const void *key2))
 {
    int j;
 
@@ -69,16 +65,368 @@ int mgsort(void *data, int size, int esize, int i, int k, int (*compare)(const v
       /* Determine where to divide the elements */
       j = (int)((i + k - 1) / 2);
 
-      if (mgsort(data, size, esize, i, j, compare) < 0)
-         return -1;
-
-      if (mgsort(data, size, esize, j + 1, k, compare) < 0)
-         return -1;
+      divide(data, m, esize, i, j, compare);
+      divide(data, m, esize, j + 1, k, compare);
 
       /* Merge the two sorted divisions into a single sorted set. */
-      if (merge(data, esize, i, j, k, compare) < 0)
-         return -1;
+      merge(data, m, esize, i, j, k, compare);
+   }
+}
+
+int mgsort(void *data, int size, int esize, int i, int k, int (*compare)(const void *key1, const void *key2))
+{
+   char *m;
+
+   (void)size;
+
+   /* Stop when no divisions can be made. */
+   if (i >= k)
+      return 0;
+
+   /* Allocate storage for the merged elements once for all merges. */
+   if ((m = (char *) malloc(esize * ((k - i) + 1))) == NULL)
+      return -1;
+
+   divide(data, m, esize, i, k, compare);
+
+   /* Free the storage allocated for merging. */
+   free(m);
+   return 0;
+}
+
+static int gallop(const char *key, char *run, int len, int right, int from_end, int esize,
+   int (*compare)(const void *key1, const void *key2))
+{
+   int lo, hi, mid, ofs, c;
+
+   /*
+    * Return the number of elements in the run that go before key: those less than key, and also
+    * those equal to key when right is set. Probe exponentially from the start or the end of the run
+    * to bracket the answer, then finish with a binary search.
+    */
+   lo = 0;
+   hi = len;
+   ofs = 1;
+
+   if (!from_end) {
+      while (ofs <= len && ((c = compare(&run[(ofs - 1) * esize], key)) < 0 || (right && c == 0))) {
+         lo = ofs;
+         ofs = ofs > len / 2 ? len + 1 : ofs * 2;
+      }
+      if (ofs - 1 < hi)
+         hi = ofs - 1;
+   }
+   else {
+      while (ofs <= len && !((c = compare(&run[(len - ofs) * esize], key)) < 0 || (right && c == 0))) {
+         hi = len - ofs;
+         ofs = ofs > len / 2 ? len + 1 : ofs * 2;
+      }
+      if (len - ofs + 1 > lo)
+         lo = len - ofs + 1;
+   }
+
+   while (lo < hi) {
+      mid = lo + (hi - lo) / 2;
+      c = compare(&run[mid * esize], key);
+
+      if (c < 0 || (right && c == 0))
+         lo = mid + 1;
+      else
+         hi = mid;
+   }
+
+   return lo;
+}
+
+static void merge_lo(char *a, char *buf, int esize, int base1, int len1, int base2, int len2,
+   int *min_gallop, int (*compare)(const void *key1, const void *key2))
+{
+   int i, j, d, count1, count2;
+
+   /* Move the left run, the shorter one, out of the way and merge from the front. */
+   memcpy(buf, &a[base1 * esize], len1 * esize);
+   i = 0;
+   j = base2;
+   d = base1;
+
+   while (len1 > 0 && len2 > 0) {
+      /* Merge one element at a time until one run wins repeatedly. */
+      count1 = count2 = 0;
+
+      while (len1 > 0 && len2 > 0 && count1 < *min_gallop && count2 < *min_gallop) {
+         if (compare(&a[j * esize], &buf[i * esize]) < 0) {
+            memcpy(&a[d++ * esize], &a[j++ * esize], esize);
+            len2--;
+            count2++;
+            count1 = 0;
+         }
+         else {
+            memcpy(&a[d++ * esize], &buf[i++ * esize], esize);
+            len1--;
+            count1++;
+            count2 = 0;
+         }
+      }
+
+      /* Gallop, moving whole blocks of elements while the runs do not interleave. */
+      while (len1 > 0 && len2 > 0) {
+         count1 = gallop(&a[j * esize], &buf[i * esize], len1, 1, 0, esize, compare);
+         memcpy(&a[d * esize], &buf[i * esize], count1 * esize);
+         d += count1;
+         i += count1;
+         len1 -= count1;
+
+         if (len1 == 0)
+            break;
+
+         count2 = gallop(&buf[i * esize], &a[j * esize], len2, 0, 0, esize, compare);
+         memmove(&a[d * esize], &a[j * esize], count2 * esize);
+         d += count2;
+         j += count2;
+         len2 -= count2;
+
+         /* Make galloping easier to enter while it pays off, and harder once it stops paying. */
+         if (count1 < TMSORT_MIN_GALLOP && count2 < TMSORT_MIN_GALLOP) {
+            *min_gallop += 2;
+            break;
+         }
+
+         if (*min_gallop > 1)
+            (*min_gallop)--;
+      }
+   }
+
+   /* Pass back what remains of the left run; what remains of the right run is in place. */
+   memcpy(&a[d * esize], &buf[i * esize], len1 * esize);
+}
+
+static void merge_hi(char *a, char *buf, int esize, int base1, int len1, int base2, int len2,
+   int *min_gallop, int (*compare)(const void *key1, const void *key2))
+{
+   int i, j, d, count1, count2;
+
+   /* Move the right run, the shorter one, out of the way and merge from the back. */
+   memcpy(buf, &a[base2 * esize], len2 * esize);
+   i = len2 - 1;
+   j = base1 + len1 - 1;
+   d = base2 + len2 - 1;
+
+   while (len1 > 0 && len2 > 0) {
+      /* Merge one element at a time until one run wins repeatedly. */
+      count1 = count2 = 0;
+
+      while (len1 > 0 && len2 > 0 && count1 < *min_gallop && count2 < *min_gallop) {
+         if (compare(&buf[i * esize], &a[j * esize]) < 0) {
+            memcpy(&a[d-- * esize], &a[j-- * esize], esize);
+            len1--;
+            count1++;
+            count2 = 0;
+         }
+         else {
+            memcpy(&a[d-- * esize], &buf[i-- * esize], esize);
+            len2--;
+            count2++;
+            count1 = 0;
+         }
+      }
+
+      /* Gallop, moving whole blocks of elements while the runs do not interleave. */
+      while (len1 > 0 && len2 > 0) {
+         count1 = len1 - gallop(&buf[i * esize], &a[base1 * esize], len1, 1, 1, esize, compare);
+         d -= count1;
+         j -= count1;
+         len1 -= count1;
+         memmove(&a[(d + 1) * esize], &a[(j + 1) * esize], count1 * esize);
+
+         if (len1 == 0)
+            break;
+
+         count2 = len2 - gallop(&a[j * esize], buf, len2, 0, 1, esize, compare);
+         d -= count2;
+         i -= count2;
+         len2 -= count2;
+         memcpy(&a[(d + 1) * esize], &buf[(i + 1) * esize], count2 * esize);
+
+         /* Make galloping easier to enter while it pays off, and harder once it stops paying. */
+         if (count1 < TMSORT_MIN_GALLOP && count2 < TMSORT_MIN_GALLOP) {
+            *min_gallop += 2;
+            break;
+         }
+
+         if (*min_gallop > 1)
+            (*min_gallop)--;
+      }
    }
 
+   /* Pass back what remains of the right run; what remains of the left run is in place. */
+   memcpy(&a[(d - len2 + 1) * esize], buf, len2 * esize);
+}
+
+static void merge_runs(char *a, char *buf, int esize, int base1, int len1, int base2, int len2,
+   int *min_gallop, int (*compare)(const void *key1, const void *key2))
+{
+   int k;
+
+   /* Skip the elements of the left run that are already before the whole right run. */
+   k = gallop(&a[base2 * esize], &a[base1 * esize], len1, 1, 0, esize, compare);
+   base1 += k;
+   len1 -= k;
+
+   if (len1 == 0)
+      return;
+
+   /* Skip the elements of the right run that are already after the whole left run. */
+   len2 = gallop(&a[(base1 + len1 - 1) * esize], &a[base2 * esize], len2, 0, 1, esize, compare);
+
+   if (len2 == 0)
+      return;
+
+   /* Merge from the side of the shorter run, which is the one copied to the buffer. */
+   if (len1 <= len2)
+      merge_lo(a, buf, esize, base1, len1, base2, len2, min_gallop, compare);
+   else
+      merge_hi(a, buf, esize, base1, len1, base2, len2, min_gallop, compare);
+}
+
+static int count_run(char *a, char *temp, int esize, int lo, int size,
+   int (*compare)(const void *key1, const void *key2))
+{
+   int hi, i, j;
+
+   /* Find where the run starting at lo ends. */
+   hi = lo + 1;
+
+   if (hi == size)
+      return 1;
+
+   if (compare(&a[hi * esize], &a[lo * esize]) < 0) {
+      /* Extend a strictly descending run, then reverse it in place. */
+      while (hi + 1 < size && compare(&a[(hi + 1) * esize], &a[hi * esize]) < 0)
+         hi++;
+
+      for (i = lo, j = hi; i < j; i++, j--) {
+         memcpy(temp, &a[i * esize], esize);
+         memcpy(&a[i * esize], &a[j * esize], esize);
+         memcpy(&a[j * esize], temp, esize);
+      }
+   }
+   else {
+      /* Extend an ascending run. */
+      while (hi + 1 < size && compare(&a[(hi + 1) * esize], &a[hi * esize]) >= 0)
+         hi++;
+   }
+
+   return hi - lo + 1;
+}
+
+static void binary_insertion(char *a, char *temp, int esize, int lo, int start, int hi,
+   int (*compare)(const void *key1, const void *key2))
+{
+   int j, pos, left, mid;
+
+   /* Insert each element after start into the sorted elements before it, after any equal ones. */
+   for (j = start; j < hi; j++) {
+      pos = lo;
+      left = j;
+
+      while (pos < left) {
+         mid = pos + (left - pos) / 2;
+
+         if (compare(&a[j * esize], &a[mid * esize]) < 0)
+            left = mid;
+         else
+            pos = mid + 1;
+      }
+
+      if (pos == j)
+         continue;
+
+      memcpy(temp, &a[j * esize], esize);
+      memmove(&a[(pos + 1) * esize], &a[pos * esize], (j - pos) * esize);
+      memcpy(&a[pos * esize], temp, esize);
+   }
+}
+
+int tmsort(void *data, int size, int esize, int (*compare)(const void *key1, const void *key2))
+{
+   char *a = data;
+   char *buf;
+   int base[TMSORT_MAX_RUNS], len[TMSORT_MAX_RUNS];
+   int runs, lo, n, minrun, r, force, m, min_gallop;
+
+   if (size < 2)
+      return 0;
+
+   /* Allocate storage for the shorter run of any merge once, up front. */
+   if ((buf = (char *) malloc(esize * (size / 2 + 1))) == NULL)
+      return -1;
+
+   /* Compute a minimum run length between 32 and 64 that splits size evenly in powers of two. */
+   for (n = size, r = 0; n >= 64; n >>= 1)
+      r |= n & 1;
+
+   minrun = n + r;
+   runs = 0;
+   min_gallop = TMSORT_MIN_GALLOP;
+
+   for (lo = 0; lo < size; lo += n) {
+      /* Find the next natural run, extending short runs with binary insertion sort. */
+      n = count_run(a, buf, esize, lo, size, compare);
+
+      if (n < minrun) {
+         force = size - lo < minrun ? size - lo : minrun;
+         binary_insertion(a, buf, esize, lo, lo + n, lo + force, compare);
+         n = force;
+      }
+
+      base[runs] = lo;
+      len[runs] = n;
+      runs++;
+
+      /* Merge pending runs until their lengths shrink at least as fast as the Fibonacci numbers. */
+      while (runs > 1) {
+         m = runs - 2;
+
+         if ((m > 0 && len[m - 1] <= len[m] + len[m + 1]) ||
+             (m > 1 && len[m - 2] <= len[m - 1] + len[m])) {
+            if (len[m - 1] < len[m + 1])
+               m--;
+         }
+         else if (len[m] > len[m + 1]) {
+            break;
+         }
+
+         merge_runs(a, buf, esize, base[m], len[m], base[m + 1], len[m + 1], &min_gallop, compare);
+         len[m] += len[m + 1];
+
+         if (m == runs - 3) {
+            base[m + 1] = base[m + 2];
+            len[m + 1] = len[m + 2];
+         }
+
+         runs--;
+      }
+   }
+
+   /* Merge the remaining runs from the last to the first. */
+   while (runs > 1) {
+      m = runs - 2;
+
+      if (m > 0 && len[m - 1] < len[m + 1])
+         m--;
+
+      merge_runs(a, buf, esize, base[m], len[m], base[m + 1], len[m + 1], &min_gallop, compare);
+      len[m] += len[m + 1];
+
+      if (m == runs - 3) {
+         base[m + 1] = base[m + 2];
+         len[m + 1] = len[m + 2];
+      }
+
+      runs--;
+   }
+
+   /* Free the storage allocated for merging. */
+   free(buf);
    return 0;
 }
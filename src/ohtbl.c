@@ -13,6 +13,97 @@
 /* Reserve a sentinel memory address for vacated elements. */
 static char vacated;
 
+/*
+ * Define private macros used by Robin Hood hashing.
+ */
+
+#define ohtbl_home(htbl, key) ((int)((unsigned int)(htbl)->h1(key) % (unsigned int)(htbl)->positions))
+
+#define ohtbl_next(htbl, position) ((position) + 1 == (htbl)->positions ? 0 : (position) + 1)
+
+static int rh_find(const OHTbl *htbl, const void *data)
+{
+    int position, probe;
+
+    /* Probe linearly from the position the key hashes to. */
+    position = ohtbl_home(htbl, data);
+
+    for (probe = 0; probe < htbl->positions; probe++)
+    {
+        /* 
+         * Stop at an empty position, or at an element closer to its own hashed position than the
+         * key would be, since the key would have displaced that element when inserted.
+         */
+        if (htbl->table[position] == NULL || htbl->probes[position] < probe)
+            return -1;
+
+        if (htbl->match(htbl->table[position], data))
+            return position;
+
+        position = ohtbl_next(htbl, position);
+    }
+
+    return -1;
+}
+
+static int rh_insert(OHTbl *htbl, const void *data)
+{
+    void *temp;
+    int position, probe, swap;
+
+    /* Probe linearly from the position the key hashes to. */
+    temp = (void *)data;
+    position = ohtbl_home(htbl, temp);
+    probe = 0;
+
+    while (htbl->table[position] != NULL)
+    {
+        if (htbl->probes[position] < probe)
+        {
+            /* Take the position of an element closer to its own hashed position. */
+            data = htbl->table[position];
+            htbl->table[position] = temp;
+            temp = (void *)data;
+
+            swap = htbl->probes[position];
+            htbl->probes[position] = probe;
+            probe = swap;
+        }
+
+        position = ohtbl_next(htbl, position);
+        probe++;
+    }
+
+    /* Insert the displaced element into the empty position. */
+    htbl->table[position] = temp;
+    htbl->probes[position] = probe;
+    htbl->size++;
+
+    return 0;
+}
+
+static void rh_remove(OHTbl *htbl, int position)
+{
+    int next;
+
+    /* Shift back the following elements until one is at its hashed position. */
+    next = ohtbl_next(htbl, position);
+
+    while (htbl->table[next] != NULL && htbl->probes[next] > 0)
+    {
+        htbl->table[position] = htbl->table[next];
+        htbl->probes[position] = htbl->probes[next] - 1;
+        position = next;
+        next = ohtbl_next(htbl, position);
+    }
+
+    htbl->table[position] = NULL;
+    htbl->probes[position] = 0;
+    htbl->size--;
+
+    return;
+}
+
 int ohtbl_init(OHTbl *htbl, int positions, int (*h1)(const void *key), 
                int (*h2)(const void *key), int (*match)(const void *key1, const void *key2), 
                void (*destroy)(void *data))
@@ -40,10 +131,31 @@ int ohtbl_init(OHTbl *htbl, int positions, int (*h1)(const void *key),
 
     /* Initialize the number of elements in the table */
     htbl->size = 0;
+
+    /* Use double hashing. */
+    htbl->probes = NULL;
     
     return 0;
 }
 
+int ohtbl_init_robin_hood(OHTbl *htbl, int positions, int (*h)(const void *key),
+                          int (*match)(const void *key1, const void *key2),
+                          void (*destroy)(void *data))
+{
+    /* Initialize the table as for double hashing, with h as the only hash function. */
+    if (ohtbl_init(htbl, positions, h, NULL, match, destroy) != 0)
+        return -1;
+
+    /* Allocate space for the probe lengths. */
+    if ((htbl->probes = (int *)calloc(positions, sizeof(int))) == NULL)
+    {
+        free(htbl->table);
+        return -1;
+    }
+
+    return 0;
+}
+
 void ohtbl_destroy(OHTbl *htbl)
 {
     int i;
@@ -60,6 +172,7 @@ void ohtbl_destroy(OHTbl *htbl)
 
     /* Free the storage allocated for the hash table. */
     free(htbl->table);
+    free(htbl->probes);
 
     /* No operations are allowed now, but clear the structure as a precaution. */
     memset(htbl, 0, sizeof(OHTbl));
@@ -81,6 +194,9 @@ int ohtbl_insert(OHTbl *htbl, const void *data)
 
     if(ohtbl_lookup(htbl, &temp) == 0)
         return 1;
+
+    if (htbl->probes != NULL)
+        return rh_insert(htbl, data);
     
     /* Use double hashing to hash the key. */
     for (i=0; i < htbl->positions; i++)
@@ -104,10 +220,21 @@ int ohtbl_remove(OHTbl *htbl, const void **data)
 {
     int position, i;
 
+    if (htbl->probes != NULL)
+    {
+        /* Find the data, pass it back, and shift back the elements that follow it. */
+        if ((position = rh_find(htbl, *data)) < 0)
+            return -1;
+
+        *data = htbl->table[position];
+        rh_remove(htbl, position);
+        return 0;
+    }
+
     /* Use double hashing to hash the key. */
     for (i=0; i < htbl->positions; i++)
     {
-        position = (htbl->h1(data) + (i * htbl->h2(*data))) % htbl->positions;
+        position = (htbl->h1(*data) + (i * htbl->h2(*data))) % htbl->positions;
 
         if (htbl->table[position] == NULL)
         {
@@ -137,16 +264,31 @@ int ohtbl_lookup(const OHTbl *htbl, void **data)
 {
     int position, i;
 
+    if (htbl->probes != NULL)
+    {
+        /* Pass back the data from the table if it is found. */
+        if ((position = rh_find(htbl, *data)) < 0)
+            return -1;
+
+        *data = htbl->table[position];
+        return 0;
+    }
+
     /* Use double hashing to hash the key. */
     for (i=0; i < htbl->positions; i++)
     {
-        position = (htbl->h1(*data) + (i * htbl->h2(*data))) & htbl->positions;
+        position = (htbl->h1(*data) + (i * htbl->h2(*data))) % htbl->positions;
 
         if (htbl->table[position] == NULL)
         {
             /* Return that the data was not found. */
             return -1;
         }
+        else if (htbl->table[position] == htbl->vacated)
+        {
+            /* Search beyond vacated positions. */
+            continue;
+        }
         else if (htbl->match(htbl->table[position], *data))
         {
             /* Pass back the data from the table. */
@@ -0,0 +1,331 @@
+/**
+ * @file prxsort.c
+ * @date 16 October 2026
+ * @brief Implementation of the parallel radix sort.
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sort.h"
+
+/* Number of bits in each digit, and the resulting radix. */
+#define PRXSORT_BITS 8
+#define PRXSORT_RADIX (1 << PRXSORT_BITS)
+
+/* Number of bytes gathered for each digit value before they are written out, one cache line. */
+#define PRXSORT_WC 64
+
+/* Smallest number of elements worth handing to a thread of its own. */
+#define PRXSORT_GRAIN 65536
+
+/* Define how the keys are mapped to unsigned integers in the same order. */
+enum {
+   PRXSORT_UNSIGNED,
+   PRXSORT_SIGNED,
+   PRXSORT_FLOAT
+};
+
+/* Define a structure for the state shared by the threads sorting the same data. */
+typedef struct PRxSort_ {
+   unsigned char *data;
+   unsigned char *temp;
+   unsigned char *sorted;
+   int size;
+   int width;
+   int mode;
+   int nthreads;
+   int started;
+   int (*counts)[PRXSORT_RADIX];
+   pthread_mutex_t lock;
+   pthread_cond_t start;
+   pthread_barrier_t barrier;
+} PRxSort;
+
+/* Define a structure for the arguments of each thread. */
+typedef struct PRxWorker_ {
+   PRxSort *sort;
+   int id;
+} PRxWorker;
+
+static uint64_t key_at(const unsigned char *p, int width, int mode)
+{
+   uint64_t key, sign;
+   uint32_t key32;
+
+   /* Load the key. */
+   if (width == 4) {
+      memcpy(&key32, p, 4);
+      key = key32;
+   }
+   else {
+      memcpy(&key, p, 8);
+   }
+
+   sign = (uint64_t)1 << (width * 8 - 1);
+
+   /* Map the key to an unsigned integer so that the keys sort in the right order. */
+   if (mode == PRXSORT_SIGNED)
+      key ^= sign;
+   else if (mode == PRXSORT_FLOAT)
+      key ^= (key & sign) ? (sign | (sign - 1)) : sign;
+
+   return key;
+}
+
+static void sort_range(PRxSort *sort, int id)
+{
+   unsigned char wc[PRXSORT_RADIX][PRXSORT_WC];
+   int fill[PRXSORT_RADIX], offsets[PRXSORT_RADIX];
+   unsigned char *src, *dst, *swap;
+   int width, mode, per, lo, hi, base, total, skip, shift, d, t, v, j;
+
+   width = sort->width;
+   mode = sort->mode;
+   per = PRXSORT_WC / width;
+
+   /* Determine the block of elements counted and scattered by this thread. */
+   lo = (int)((long long)sort->size * id / sort->nthreads);
+   hi = (int)((long long)sort->size * (id + 1) / sort->nthreads);
+
+   src = sort->data;
+   dst = sort->temp;
+
+   for (d = 0; d < width; d++) {
+      shift = d * PRXSORT_BITS;
+
+      /* Count the occurrences of each digit value in the block. */
+      memset(sort->counts[id], 0, sizeof(sort->counts[id]));
+
+      for (j = lo; j < hi; j++)
+         sort->counts[id][(key_at(&src[(size_t)j * width], width, mode) >> shift) & (PRXSORT_RADIX - 1)]++;
+
+      pthread_barrier_wait(&sort->barrier);
+
+      /* 
+       * Each digit value starts after all the smaller values, and this thread writes its
+       * elements after those of the same value in the blocks before it.
+       */
+      skip = 0;
+
+      for (v = 0, base = 0; v < PRXSORT_RADIX; v++) {
+         offsets[v] = base;
+
+         for (t = 0, total = 0; t < sort->nthreads; t++) {
+            if (t == id)
+               offsets[v] = base + total;
+
+            total += sort->counts[t][v];
+         }
+
+         /* Skip the position when every element has the same digit in it. */
+         if (total == sort->size)
+            skip = 1;
+
+         base += total;
+      }
+
+      if (!skip) {
+         /* Gather elements by digit value, writing out a cache line worth at a time. */
+         memset(fill, 0, sizeof(fill));
+
+         for (j = lo; j < hi; j++) {
+            v = (key_at(&src[(size_t)j * width], width, mode) >> shift) & (PRXSORT_RADIX - 1);
+
+            if (width == 4)
+               memcpy(&wc[v][fill[v] * 4], &src[(size_t)j * 4], 4);
+            else
+               memcpy(&wc[v][fill[v] * 8], &src[(size_t)j * 8], 8);
+
+            if (++fill[v] == per) {
+               memcpy(&dst[(size_t)offsets[v] * width], wc[v], PRXSORT_WC);
+               offsets[v] += per;
+               fill[v] = 0;
+            }
+         }
+
+         /* Write out the elements still gathered. */
+         for (v = 0; v < PRXSORT_RADIX; v++)
+            memcpy(&dst[(size_t)offsets[v] * width], wc[v], fill[v] * width);
+
+         swap = src;
+         src = dst;
+         dst = swap;
+      }
+
+      /* Wait for every element to be placed, and for the counts to be read, before the next position. */
+      pthread_barrier_wait(&sort->barrier);
+   }
+
+   if (id == 0)
+      sort->sorted = src;
+
+   return;
+}
+
+static void *run_worker(void *arg)
+{
+   PRxWorker *worker = arg;
+   PRxSort *sort = worker->sort;
+
+   /* Wait until the number of threads sorting the data is settled. */
+   pthread_mutex_lock(&sort->lock);
+
+   while (!sort->started)
+      pthread_cond_wait(&sort->start, &sort->lock);
+
+   pthread_mutex_unlock(&sort->lock);
+
+   sort_range(sort, worker->id);
+
+   return NULL;
+}
+
+static int prxsort(void *data, int size, int width, int mode, int nthreads)
+{
+   PRxSort sort;
+   PRxWorker *workers;
+   pthread_t *threads;
+   long ncpus;
+   int i;
+
+   /* Use a thread for each processor by default, but never so many that the blocks get small. */
+   if (nthreads < 1) {
+      ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+      nthreads = ncpus > 0 ? (int)ncpus : 1;
+   }
+
+   if (nthreads > size / PRXSORT_GRAIN)
+      nthreads = size / PRXSORT_GRAIN;
+
+   if (nthreads < 2)
+      return 1;
+
+   /* Allocate storage for the sorted elements, the counts and the threads. */
+   sort.data = data;
+   sort.size = size;
+   sort.width = width;
+   sort.mode = mode;
+   sort.started = 0;
+
+   if ((sort.temp = (unsigned char *)malloc((size_t)size * width)) == NULL)
+      return -1;
+
+   sort.counts = malloc(nthreads * sizeof(*sort.counts));
+   threads = (pthread_t *)malloc(nthreads * sizeof(pthread_t));
+   workers = (PRxWorker *)malloc(nthreads * sizeof(PRxWorker));
+
+   if (sort.counts == NULL || threads == NULL || workers == NULL) {
+      free(sort.temp);
+      free(sort.counts);
+      free(threads);
+      free(workers);
+      return -1;
+   }
+
+   pthread_mutex_init(&sort.lock, NULL);
+   pthread_cond_init(&sort.start, NULL);
+
+   /* Start the threads, settling for fewer if not all of them can be created. */
+   for (i = 1; i < nthreads; i++) {
+      workers[i].sort = &sort;
+      workers[i].id = i;
+
+      if (pthread_create(&threads[i], NULL, run_worker, &workers[i]) != 0)
+         break;
+   }
+
+   sort.nthreads = i;
+   pthread_barrier_init(&sort.barrier, NULL, sort.nthreads);
+
+   pthread_mutex_lock(&sort.lock);
+   sort.started = 1;
+   pthread_cond_broadcast(&sort.start);
+   pthread_mutex_unlock(&sort.lock);
+
+   /* The calling thread sorts the first block. */
+   sort_range(&sort, 0);
+
+   for (i = 1; i < sort.nthreads; i++)
+      pthread_join(threads[i], NULL);
+
+   /* Prepare to pass back the sorted data. */
+   if (sort.sorted != sort.data)
+      memcpy(sort.data, sort.sorted, (size_t)size * width);
+
+   /* Free the storage allocated for sorting. */
+   pthread_barrier_destroy(&sort.barrier);
+   pthread_cond_destroy(&sort.start);
+   pthread_mutex_destroy(&sort.lock);
+
+   free(sort.temp);
+   free(sort.counts);
+   free(threads);
+   free(workers);
+
+   return 0;
+}
+
+int prxsort_u32(uint32_t *data, int size, int nthreads)
+{
+   int retval;
+
+   /* Sort on the calling thread alone when the data is too small to share. */
+   if ((retval = prxsort(data, size, 4, PRXSORT_UNSIGNED, nthreads)) == 1)
+      return rxsort_u32(data, size);
+
+   return retval;
+}
+
+int prxsort_i32(int32_t *data, int size, int nthreads)
+{
+   int retval;
+
+   if ((retval = prxsort(data, size, 4, PRXSORT_SIGNED, nthreads)) == 1)
+      return rxsort_i32(data, size);
+
+   return retval;
+}
+
+int prxsort_u64(uint64_t *data, int size, int nthreads)
+{
+   int retval;
+
+   if ((retval = prxsort(data, size, 8, PRXSORT_UNSIGNED, nthreads)) == 1)
+      return rxsort_u64(data, size);
+
+   return retval;
+}
+
+int prxsort_i64(int64_t *data, int size, int nthreads)
+{
+   int retval;
+
+   if ((retval = prxsort(data, size, 8, PRXSORT_SIGNED, nthreads)) == 1)
+      return rxsort_i64(data, size);
+
+   return retval;
+}
+
+int prxsort_f32(float *data, int size, int nthreads)
+{
+   int retval;
+
+   if ((retval = prxsort(data, size, 4, PRXSORT_FLOAT, nthreads)) == 1)
+      return rxsort_f32(data, size);
+
+   return retval;
+}
+
+int prxsort_f64(double *data, int size, int nthreads)
+{
+   int retval;
+
+   if ((retval = prxsort(data, size, 8, PRXSORT_FLOAT, nthreads)) == 1)
+      return rxsort_f64(data, size);
+
+   return retval;
+}
@@ -0,0 +1,206 @@
+/**
+ * @file psort.c
+ * @date 16 October 2026
+ * @brief Implementation of the parallel quicksort.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sort.h"
+#include "tpool.h"
+
+/* Partitions with at most this many elements are sorted with qksort by a single task. */
+#define PSORT_GRAIN 8192
+
+/* Elements of up to half this many bytes are partitioned without allocating scratch storage. */
+#define PSORT_STACK 256
+
+/* Define a structure for the state shared by the tasks sorting the same data. */
+typedef struct PSort_ {
+   TPool pool;
+   int esize;
+   int (*compare)(const void *key1, const void *key2);
+
+   pthread_mutex_t lock;
+   int failed;
+} PSort;
+
+/* Define a structure for a partition sorted by a task. */
+typedef struct PSortTask_ {
+   PSort *sort;
+   char *a;
+   int n;
+   int depth;
+} PSortTask;
+
+static void partition(PSort *sort, char *a, int n, int depth);
+
+static void fail(PSort *sort)
+{
+   pthread_mutex_lock(&sort->lock);
+   sort->failed = 1;
+   pthread_mutex_unlock(&sort->lock);
+}
+
+static void swap(char *a, char *b, int esize, char *temp)
+{
+   /* Exchange two elements through the scratch element. */
+   memcpy(temp, a, esize);
+   memcpy(a, b, esize);
+   memcpy(b, temp, esize);
+}
+
+static int median3(char *a, int esize, int x, int y, int z, int (*compare)(const void *key1, const void *key2))
+{
+   /* Return the position of the median of three elements. */
+   if (compare(&a[(size_t)x * esize], &a[(size_t)y * esize]) < 0) {
+      if (compare(&a[(size_t)y * esize], &a[(size_t)z * esize]) < 0)
+         return y;
+      return compare(&a[(size_t)x * esize], &a[(size_t)z * esize]) < 0 ? z : x;
+   }
+   else {
+      if (compare(&a[(size_t)y * esize], &a[(size_t)z * esize]) > 0)
+         return y;
+      return compare(&a[(size_t)x * esize], &a[(size_t)z * esize]) > 0 ? z : x;
+   }
+}
+
+static void run_task(void *arg)
+{
+   PSortTask *task = arg;
+
+   partition(task->sort, task->a, task->n, task->depth);
+   free(task);
+}
+
+static void spawn(PSort *sort, char *a, int n, int depth)
+{
+   PSortTask *task;
+
+   /* Hand the partition to the pool, so that an idle worker can steal it. */
+   if ((task = (PSortTask *)malloc(sizeof(PSortTask))) != NULL) {
+      task->sort = sort;
+      task->a = a;
+      task->n = n;
+      task->depth = depth;
+
+      if (tpool_submit(&sort->pool, run_task, task) == 0)
+         return;
+
+      free(task);
+   }
+
+   /* Sort the partition on the calling thread when it cannot be handed to the pool. */
+   partition(sort, a, n, depth);
+}
+
+static void partition(PSort *sort, char *a, int n, int depth)
+{
+   char stack[PSORT_STACK];
+   char *scratch, *pval, *temp;
+   int esize = sort->esize;
+   int s, m, p, lt, gt, j, c;
+
+   /* Use storage on the stack for the partition value and swapping, unless elements are large. */
+   if (n <= PSORT_GRAIN || esize * 2 <= PSORT_STACK) {
+      scratch = stack;
+   }
+   else if ((scratch = (char *)malloc(esize * 2)) == NULL) {
+      fail(sort);
+      return;
+   }
+
+   pval = scratch;
+   temp = scratch + esize;
+
+   /* Split large partitions, handing one part to the pool, until partitioning degrades. */
+   while (n > PSORT_GRAIN && depth-- > 0) {
+      /* Select the partition value using the ninther. */
+      m = n / 2;
+      s = n / 8;
+      p = median3(a, esize,
+                  median3(a, esize, 0, s, 2 * s, sort->compare),
+                  median3(a, esize, m - s, m, m + s, sort->compare),
+                  median3(a, esize, n - 1 - 2 * s, n - 1 - s, n - 1, sort->compare), sort->compare);
+
+      memcpy(pval, &a[(size_t)p * esize], esize);
+
+      /* Create three partitions: less than, equal to, and greater than the partition value. */
+      lt = 0;
+      gt = n - 1;
+      j = 0;
+
+      while (j <= gt) {
+         c = sort->compare(&a[(size_t)j * esize], pval);
+
+         if (c < 0) {
+            if (lt != j)
+               swap(&a[(size_t)lt * esize], &a[(size_t)j * esize], esize, temp);
+            lt++;
+            j++;
+         }
+         else if (c > 0) {
+            swap(&a[(size_t)j * esize], &a[(size_t)gt * esize], esize, temp);
+            gt--;
+         }
+         else {
+            j++;
+         }
+      }
+
+      /* Hand the larger partition to the pool, and keep splitting the smaller one. */
+      if (lt > n - 1 - gt) {
+         if (lt > 1)
+            spawn(sort, a, lt, depth);
+
+         a = &a[(size_t)(gt + 1) * esize];
+         n = n - 1 - gt;
+      }
+      else {
+         if (n - 1 - gt > 1)
+            spawn(sort, &a[(size_t)(gt + 1) * esize], n - 1 - gt, depth);
+
+         n = lt;
+      }
+   }
+
+   if (scratch != stack)
+      free(scratch);
+
+   /* Sort what remains of the partition on this thread. */
+   if (n > 1 && qksort(a, n, esize, 0, n - 1, sort->compare) != 0)
+      fail(sort);
+}
+
+int psort(void *data, int size, int esize, int (*compare)(const void *key1, const void *key2), int nthreads)
+{
+   PSort sort;
+   int depth, n;
+
+   /* Sort on the calling thread alone when the data is too small to share. */
+   if (nthreads == 1 || size <= PSORT_GRAIN)
+      return size > 1 ? qksort(data, size, esize, 0, size - 1, compare) : 0;
+
+   if (tpool_init(&sort.pool, nthreads) != 0)
+      return -1;
+
+   sort.esize = esize;
+   sort.compare = compare;
+   sort.failed = 0;
+   pthread_mutex_init(&sort.lock, NULL);
+
+   /* Allow twice the ideal depth of partitioning before leaving partitions to qksort. */
+   for (depth = 0, n = size; n > 1; n >>= 1)
+      depth += 2;
+
+   /* Start with the whole array, and wait for all the partitions to be sorted. */
+   spawn(&sort, data, size, depth);
+   tpool_wait(&sort.pool);
+
+   tpool_destroy(&sort.pool);
+   pthread_mutex_destroy(&sort.lock);
+
+   return sort.failed ? -1 : 0;
+}
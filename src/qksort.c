@@ -3,85 +3,153 @@
 
 #include "sort.h"
 
-/*
- * @brief Compare two integers. Used during median-of-three partitioning.
- */
-static int compare_int(const void *int1, const void *int2) {
-   if (*(const int*)int1 > *(const int *)int2)
-      return 1;
-   else if (*(const int *)int1 < *(const int *)int2)
-      return -1;
-   else
-      return 0;
+/* Partitions with at most this many elements are finished with insertion sort. */
+#define QKSORT_CUTOFF 16
+
+/* Partitions with at least this many elements use the ninther to select the partition value. */
+#define QKSORT_NINTHER 128
+
+/* Elements of up to half this many bytes are sorted without allocating scratch storage. */
+#define QKSORT_STACK 256
+
+static void swap(char *a, char *b, int esize, char *temp)
+{
+   /* Exchange two elements through the scratch element. */
+   memcpy(temp, a, esize);
+   memcpy(a, b, esize);
+   memcpy(b, temp, esize);
 }
 
-static int partition(void *data, int esize, int i, int k, int (*compare)(const void *key1, const void *key2)) {
-   char *a = data;
-   void *pval, *temp;
-   int r[3];
+static int median3(char *a, int esize, int x, int y, int z, int (*compare)(const void *key1, const void *key2))
+{
+   /* Return the position of the median of three elements. */
+   if (compare(&a[x * esize], &a[y * esize]) < 0) {
+      if (compare(&a[y * esize], &a[z * esize]) < 0)
+         return y;
+      return compare(&a[x * esize], &a[z * esize]) < 0 ? z : x;
+   }
+   else {
+      if (compare(&a[y * esize], &a[z * esize]) > 0)
+         return y;
+      return compare(&a[x * esize], &a[z * esize]) > 0 ? z : x;
+   }
+}
 
-   /* Allocate storage for the partition value and swapping. */
-   if ((pval = malloc(esize)) == NULL)
-      return -1;
-   if ((temp = malloc(esize)) == NULL) {
-      free(pval);
-      return -1;
+static void insertion(char *a, int esize, int i, int k, char *key, int (*compare)(const void *key1, const void *key2))
+{
+   int j, m;
+
+   /* Repeatedly insert a key element among the sorted elements. */
+   for (j = i + 1; j <= k; j++) {
+      m = j - 1;
+
+      if (compare(&a[m * esize], &a[j * esize]) <= 0)
+         continue;
+
+      memcpy(key, &a[j * esize], esize);
+
+      while (m >= i && compare(&a[m * esize], key) > 0) {
+         memcpy(&a[(m + 1) * esize], &a[m * esize], esize);
+         m--;
+      }
+      memcpy(&a[(m + 1) * esize], key, esize);
    }
+}
+
+static void introsort(char *a, int esize, int i, int k, int depth, char *pval, char *temp,
+   int (*compare)(const void *key1, const void *key2))
+{
+   int n, s, m, p, lt, gt, j, c;
+
+   while ((n = k - i + 1) > QKSORT_CUTOFF) {
+      /* Fall back to heapsort when partitioning degrades, bounding the work to O(n lg n). */
+      if (depth-- == 0) {
+         hpsort(&a[i * esize], n, esize, compare);
+         return;
+      }
 
-   /* Use the median-of-three method to find the partition value. */
-   r[0] = (rand() % (k - i + 1)) + i;
-   r[1] = (rand() % (k - i + 1)) + i;
-   r[2] = (rand() % (k - i + 1)) + i;
-   issort(r, 3, sizeof(int), compare_int);
-   memcpy(pval, &a[r[1] * esize], esize);
-
-   /* Create two partitions around the partition value */
-   i--;
-   k++;
-   while (1) {
-      /* Move left until an element is found in the wrong partition. */
-      do {
-         k--;
-      } while (compare(&a[k * esize], pval) > 0);
-
-      /* Move right until an element is found in the wrong partition. */
-      do {
-         i++;
-      } while (compare(&a[i * esize], pval) < 0);
-
-      if (i >= k) {
-         /* Stop partitioning when the left and right counters cross. */
-         break;
+      /* Select the partition value using the median of three, or the ninther for large partitions. */
+      m = i + n / 2;
+
+      if (n >= QKSORT_NINTHER) {
+         s = n / 8;
+         p = median3(a, esize,
+                     median3(a, esize, i, i + s, i + 2 * s, compare),
+                     median3(a, esize, m - s, m, m + s, compare),
+                     median3(a, esize, k - 2 * s, k - s, k, compare), compare);
+      }
+      else {
+         p = median3(a, esize, i, m, k, compare);
+      }
+
+      memcpy(pval, &a[p * esize], esize);
+
+      /* Create three partitions: less than, equal to, and greater than the partition value. */
+      lt = i;
+      gt = k;
+      j = i;
+
+      while (j <= gt) {
+         c = compare(&a[j * esize], pval);
+
+         if (c < 0) {
+            if (lt != j)
+               swap(&a[lt * esize], &a[j * esize], esize, temp);
+            lt++;
+            j++;
+         }
+         else if (c > 0) {
+            swap(&a[j * esize], &a[gt * esize], esize, temp);
+            gt--;
+         }
+         else {
+            j++;
+         }
+      }
+
+      /* Recursively sort the smaller partition and iterate on the larger, bounding the stack. */
+      if (lt - i < k - gt) {
+         introsort(a, esize, i, lt - 1, depth, pval, temp, compare);
+         i = gt + 1;
       }
       else {
-         /* Swap the elements now under the left and right counters. */
-         memcpy(temp, &a[i * esize], esize);
-         memcpy(&a[i * esize], &a[k * esize], esize);
-         memcpy(&a[k * esize], temp, esize);
+         introsort(a, esize, gt + 1, k, depth, pval, temp, compare);
+         k = lt - 1;
       }
    }
-   /* Free the storage allocated for partitioning. */
-   free(pval);
-   free(temp);
 
-   /* Return the position dividing the two partitions. */
-   return k;
+   /* Finish small partitions with insertion sort. */
+   if (i < k)
+      insertion(a, esize, i, k, temp, compare);
 }
 
 int qksort(void *data, int size, int esize, int i, int k, int (*compare)(const void *key1, const void *key2)) {
 
-   int j;
-   /* Stop the recursion when it is not possible to partition further. */
-   while(i < k) {
-      /* Determine where to partition the elements. */
-      if((j = partition(data, esize, i, k, compare)) < 0)
-         return -1;
-      /* Recursively sort the left partition. */
-      if(qksort(data, size, esize, i, j, compare) < 0)
-         return -1;
-      /* Iterate and sort the right partition */
-      i = j + 1;
-   }
+   char stack[QKSORT_STACK];
+   char *scratch;
+   int depth, n;
+
+   (void)size;
+
+   /* Stop when it is not possible to partition further. */
+   if (i >= k)
+      return 0;
+
+   /* Use storage on the stack for the partition value and swapping, unless elements are large. */
+   if (esize * 2 <= QKSORT_STACK)
+      scratch = stack;
+   else if ((scratch = (char *)malloc(esize * 2)) == NULL)
+      return -1;
+
+   /* Allow twice the ideal depth of partitioning before falling back to heapsort. */
+   for (depth = 0, n = k - i + 1; n > 1; n >>= 1)
+      depth += 2;
+
+   introsort(data, esize, i, k, depth, scratch, scratch + esize, compare);
+
+   /* Free the storage allocated for sorting. */
+   if (scratch != stack)
+      free(scratch);
 
    return 0;
 }
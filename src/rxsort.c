@@ -1,13 +1,23 @@
 #include <limits.h>
-#include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "sort.h"
 
+/* Number of bits in each digit sorted by the radix sort engine, and the resulting radix. */
+#define RXSORT_BITS 8
+#define RXSORT_RADIX (1 << RXSORT_BITS)
+
+/* Define a structure pairing the key of a record with its position, used by rxsort_keyed. */
+typedef struct RxKey_ {
+   uint64_t key;
+   int index;
+} RxKey;
+
 int rxsort(int *data, int size, int p, int k)
 {
-   int *counts, *temp;
+   int *counts, *temp, *src, *dst, *swap;
    int index, pval, i, j, n;
 
    /* Allocate storage for the counts */
@@ -22,38 +32,342 @@ int rxsort(int *data, int size, int p, int k)
    }
 
    /* Sort from the least significant position to the most significat. */
-   for (n = 0; n < p; n++)
+   src = data;
+   dst = temp;
+
+   for (n = 0, pval = 1; n < p; n++, pval = pval > INT_MAX / k ? INT_MAX : pval * k)
    {
       /* Initialize the counts. */
       memset(counts, 0, k * sizeof(int));
 
-      /* Calculate the position value. */
-      pval = (int)pow((double)k, (double)n);
-
       /* Count the occurrences of each digit value. */
       for(j = 0; j < size; j++) {
-         index = (int)(data[j] / pval) % k;
+         index = (int)(src[j] / pval) % k;
          counts[index] = counts[index] + 1;
       }
 
       /* Adjust each count to reflect the counts before it. */
-      for (i = 0; i < k; i++)
+      for (i = 1; i < k; i++)
          counts[i] = counts[i] + counts[i - 1];
 
       /* Use the counts to position each element where it belongs. */
       for (j = size - 1; j >= 0; j--) {
-         index = (int)(data[j] / pval) % k;
-         temp[counts[index] - 1] = data[j];
+         index = (int)(src[j] / pval) % k;
+         dst[counts[index] - 1] = src[j];
          counts[index] = counts[index] - 1;
       }
 
-      /* Prepare to pass back the data as sorted thus far. */
-      memcpy(data, temp, size * sizeof(int));
+      /* Sort the next position from the elements as sorted thus far. */
+      swap = src;
+      src = dst;
+      dst = swap;
    }
 
+   /* Prepare to pass back the sorted data. */
+   if (src != data)
+      memcpy(data, src, size * sizeof(int));
+
    /* Free the storage allocated for sorting. */
    free(counts);
    free(temp);
 
    return 0;
 }
+
+static int lsd32(uint32_t *data, int size)
+{
+   int (*counts)[RXSORT_RADIX];
+   uint32_t *temp, *src, *dst, *swap;
+   int offset, count, d, i, j;
+
+   /* Allocate storage for the counts of every digit position and for the sorted elements. */
+   if ((counts = calloc(sizeof(uint32_t), sizeof(*counts))) == NULL)
+      return -1;
+
+   if ((temp = (uint32_t *)malloc(size * sizeof(uint32_t))) == NULL) {
+      free(counts);
+      return -1;
+   }
+
+   /* Count the occurrences of each digit value in every position with one pass over the data. */
+   for (j = 0; j < size; j++) {
+      for (d = 0; d < (int)sizeof(uint32_t); d++)
+         counts[d][(data[j] >> (d * RXSORT_BITS)) & (RXSORT_RADIX - 1)]++;
+   }
+
+   src = data;
+   dst = temp;
+
+   for (d = 0; d < (int)sizeof(uint32_t); d++) {
+      /* Skip the position when every element has the same digit in it. */
+      if (counts[d][(src[0] >> (d * RXSORT_BITS)) & (RXSORT_RADIX - 1)] == size)
+         continue;
+
+      /* Turn the counts into the offset where each digit value starts. */
+      for (i = 0, offset = 0; i < RXSORT_RADIX; i++) {
+         count = counts[d][i];
+         counts[d][i] = offset;
+         offset += count;
+      }
+
+      /* Use the offsets to position each element where it belongs. */
+      for (j = 0; j < size; j++)
+         dst[counts[d][(src[j] >> (d * RXSORT_BITS)) & (RXSORT_RADIX - 1)]++] = src[j];
+
+      swap = src;
+      src = dst;
+      dst = swap;
+   }
+
+   /* Prepare to pass back the sorted data. */
+   if (src != data)
+      memcpy(data, src, size * sizeof(uint32_t));
+
+   /* Free the storage allocated for sorting. */
+   free(counts);
+   free(temp);
+
+   return 0;
+}
+
+static int lsd64(uint64_t *data, int size)
+{
+   int (*counts)[RXSORT_RADIX];
+   uint64_t *temp, *src, *dst, *swap;
+   int offset, count, d, i, j;
+
+   /* Allocate storage for the counts of every digit position and for the sorted elements. */
+   if ((counts = calloc(sizeof(uint64_t), sizeof(*counts))) == NULL)
+      return -1;
+
+   if ((temp = (uint64_t *)malloc(size * sizeof(uint64_t))) == NULL) {
+      free(counts);
+      return -1;
+   }
+
+   /* Count the occurrences of each digit value in every position with one pass over the data. */
+   for (j = 0; j < size; j++) {
+      for (d = 0; d < (int)sizeof(uint64_t); d++)
+         counts[d][(data[j] >> (d * RXSORT_BITS)) & (RXSORT_RADIX - 1)]++;
+   }
+
+   src = data;
+   dst = temp;
+
+   for (d = 0; d < (int)sizeof(uint64_t); d++) {
+      /* Skip the position when every element has the same digit in it. */
+      if (counts[d][(src[0] >> (d * RXSORT_BITS)) & (RXSORT_RADIX - 1)] == size)
+         continue;
+
+      /* Turn the counts into the offset where each digit value starts. */
+      for (i = 0, offset = 0; i < RXSORT_RADIX; i++) {
+         count = counts[d][i];
+         counts[d][i] = offset;
+         offset += count;
+      }
+
+      /* Use the offsets to position each element where it belongs. */
+      for (j = 0; j < size; j++)
+         dst[counts[d][(src[j] >> (d * RXSORT_BITS)) & (RXSORT_RADIX - 1)]++] = src[j];
+
+      swap = src;
+      src = dst;
+      dst = swap;
+   }
+
+   /* Prepare to pass back the sorted data. */
+   if (src != data)
+      memcpy(data, src, size * sizeof(uint64_t));
+
+   /* Free the storage allocated for sorting. */
+   free(counts);
+   free(temp);
+
+   return 0;
+}
+
+int rxsort_u32(uint32_t *data, int size)
+{
+   if (size < 2)
+      return 0;
+
+   return lsd32(data, size);
+}
+
+int rxsort_u64(uint64_t *data, int size)
+{
+   if (size < 2)
+      return 0;
+
+   return lsd64(data, size);
+}
+
+int rxsort_i32(int32_t *data, int size)
+{
+   uint32_t *a = (uint32_t *)data;
+   int j, retval;
+
+   if (size < 2)
+      return 0;
+
+   /* Flip the sign bit so that negative integers order before positive ones as unsigned. */
+   for (j = 0; j < size; j++)
+      a[j] ^= UINT32_C(0x80000000);
+
+   retval = lsd32(a, size);
+
+   for (j = 0; j < size; j++)
+      a[j] ^= UINT32_C(0x80000000);
+
+   return retval;
+}
+
+int rxsort_i64(int64_t *data, int size)
+{
+   uint64_t *a = (uint64_t *)data;
+   int j, retval;
+
+   if (size < 2)
+      return 0;
+
+   /* Flip the sign bit so that negative integers order before positive ones as unsigned. */
+   for (j = 0; j < size; j++)
+      a[j] ^= UINT64_C(0x8000000000000000);
+
+   retval = lsd64(a, size);
+
+   for (j = 0; j < size; j++)
+      a[j] ^= UINT64_C(0x8000000000000000);
+
+   return retval;
+}
+
+int rxsort_f32(float *data, int size)
+{
+   uint32_t *a = (uint32_t *)data;
+   int j, retval;
+
+   if (size < 2)
+      return 0;
+
+   /* 
+    * Map each float to an unsigned integer in the same order: flip every bit of negative numbers,
+    * and only the sign bit of positive ones.
+    */
+   for (j = 0; j < size; j++)
+      a[j] ^= (a[j] & UINT32_C(0x80000000)) ? UINT32_C(0xFFFFFFFF) : UINT32_C(0x80000000);
+
+   retval = lsd32(a, size);
+
+   /* Restore the floats from the order-preserving integers. */
+   for (j = 0; j < size; j++)
+      a[j] ^= (a[j] & UINT32_C(0x80000000)) ? UINT32_C(0x80000000) : UINT32_C(0xFFFFFFFF);
+
+   return retval;
+}
+
+int rxsort_f64(double *data, int size)
+{
+   uint64_t *a = (uint64_t *)data;
+   int j, retval;
+
+   if (size < 2)
+      return 0;
+
+   /* 
+    * Map each double to an unsigned integer in the same order: flip every bit of negative numbers,
+    * and only the sign bit of positive ones.
+    */
+   for (j = 0; j < size; j++)
+      a[j] ^= (a[j] & UINT64_C(0x8000000000000000)) ? UINT64_C(0xFFFFFFFFFFFFFFFF) :
+         UINT64_C(0x8000000000000000);
+
+   retval = lsd64(a, size);
+
+   /* Restore the doubles from the order-preserving integers. */
+   for (j = 0; j < size; j++)
+      a[j] ^= (a[j] & UINT64_C(0x8000000000000000)) ? UINT64_C(0x8000000000000000) :
+         UINT64_C(0xFFFFFFFFFFFFFFFF);
+
+   return retval;
+}
+
+int rxsort_keyed(void *data, int size, int esize, uint64_t (*key)(const void *data))
+{
+   int (*counts)[RXSORT_RADIX];
+   RxKey *keys, *temp, *src, *dst, *swap;
+   char *a = data;
+   char *sorted;
+   int offset, count, d, i, j;
+
+   if (size < 2)
+      return 0;
+
+   /* Allocate storage for the counts, the keys, and the sorted keys. */
+   if ((counts = calloc(sizeof(uint64_t), sizeof(*counts))) == NULL)
+      return -1;
+
+   if ((keys = (RxKey *)malloc(2 * size * sizeof(RxKey))) == NULL) {
+      free(counts);
+      return -1;
+   }
+
+   temp = keys + size;
+
+   /* Extract each key once, counting the occurrences of each digit value in every position. */
+   for (j = 0; j < size; j++) {
+      keys[j].key = key(&a[j * esize]);
+      keys[j].index = j;
+
+      for (d = 0; d < (int)sizeof(uint64_t); d++)
+         counts[d][(keys[j].key >> (d * RXSORT_BITS)) & (RXSORT_RADIX - 1)]++;
+   }
+
+   src = keys;
+   dst = temp;
+
+   for (d = 0; d < (int)sizeof(uint64_t); d++) {
+      /* Skip the position when every key has the same digit in it. */
+      if (counts[d][(src[0].key >> (d * RXSORT_BITS)) & (RXSORT_RADIX - 1)] == size)
+         continue;
+
+      /* Turn the counts into the offset where each digit value starts. */
+      for (i = 0, offset = 0; i < RXSORT_RADIX; i++) {
+         count = counts[d][i];
+         counts[d][i] = offset;
+         offset += count;
+      }
+
+      /* Use the offsets to position each key where it belongs. */
+      for (j = 0; j < size; j++)
+         dst[counts[d][(src[j].key >> (d * RXSORT_BITS)) & (RXSORT_RADIX - 1)]++] = src[j];
+
+      swap = src;
+      src = dst;
+      dst = swap;
+   }
+
+   free(counts);
+
+   /* Move each record to the position of its key, reusing the key storage if it is large enough. */
+   if ((size_t)esize <= sizeof(RxKey) && src != keys) {
+      sorted = (char *)keys;
+   }
+   else if ((sorted = (char *)malloc((size_t)size * esize)) == NULL) {
+      free(keys);
+      return -1;
+   }
+
+   for (j = 0; j < size; j++)
+      memcpy(&sorted[(size_t)j * esize], &a[(size_t)src[j].index * esize], esize);
+
+   memcpy(a, sorted, (size_t)size * esize);
+
+   /* Free the storage allocated for sorting. */
+   if (sorted != (char *)keys)
+      free(sorted);
+
+   free(keys);
+
+   return 0;
+}
@@ -0,0 +1,278 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "select.h"
+
+/* Partitions with at most this many elements are finished with insertion sort. */
+#define SELECT_CUTOFF 16
+
+/* Partitions with at least this many elements use the ninther to select the partition value. */
+#define SELECT_NINTHER 128
+
+/* Elements of up to half this many bytes are selected without allocating scratch storage. */
+#define SELECT_STACK 256
+
+static void swap(char *a, char *b, int esize, char *temp)
+{
+   /* Exchange two elements through the scratch element. */
+   memcpy(temp, a, esize);
+   memcpy(a, b, esize);
+   memcpy(b, temp, esize);
+}
+
+static int median3(char *a, int esize, int x, int y, int z, int (*compare)(const void *key1, const void *key2))
+{
+   /* Return the position of the median of three elements. */
+   if (compare(&a[(size_t)x * esize], &a[(size_t)y * esize]) < 0) {
+      if (compare(&a[(size_t)y * esize], &a[(size_t)z * esize]) < 0)
+         return y;
+      return compare(&a[(size_t)x * esize], &a[(size_t)z * esize]) < 0 ? z : x;
+   }
+   else {
+      if (compare(&a[(size_t)y * esize], &a[(size_t)z * esize]) > 0)
+         return y;
+      return compare(&a[(size_t)x * esize], &a[(size_t)z * esize]) > 0 ? z : x;
+   }
+}
+
+static void insertion(char *a, int esize, int i, int k, char *key, int (*compare)(const void *key1, const void *key2))
+{
+   int j, m;
+
+   /* Repeatedly insert a key element among the sorted elements. */
+   for (j = i + 1; j <= k; j++) {
+      memcpy(key, &a[(size_t)j * esize], esize);
+
+      for (m = j - 1; m >= i && compare(&a[(size_t)m * esize], key) > 0; m--)
+         memcpy(&a[(size_t)(m + 1) * esize], &a[(size_t)m * esize], esize);
+
+      memcpy(&a[(size_t)(m + 1) * esize], key, esize);
+   }
+}
+
+static void select_range(char *a, int esize, int i, int k, int target, int depth, char *pval, char *temp,
+   int (*compare)(const void *key1, const void *key2));
+
+static int median_of_medians(char *a, int esize, int i, int k, char *pval, char *temp,
+   int (*compare)(const void *key1, const void *key2))
+{
+   int g, e, m;
+
+   /* Sort each group of five elements, and gather the medians of the groups at the front. */
+   for (g = i, m = i; g <= k; g += 5, m++) {
+      e = g + 4 <= k ? g + 4 : k;
+      insertion(a, esize, g, e, temp, compare);
+      swap(&a[(size_t)m * esize], &a[(size_t)(g + (e - g) / 2) * esize], esize, temp);
+   }
+
+   /* Select the median of the medians, choosing partition values the same way. */
+   select_range(a, esize, i, m - 1, i + (m - 1 - i) / 2, 0, pval, temp, compare);
+
+   return i + (m - 1 - i) / 2;
+}
+
+static void select_range(char *a, int esize, int i, int k, int target, int depth, char *pval, char *temp,
+   int (*compare)(const void *key1, const void *key2))
+{
+   int n, s, m, p, lt, gt, j, c;
+
+   while ((n = k - i + 1) > SELECT_CUTOFF) {
+      /* Select the partition value, using the median of medians once partitioning degrades. */
+      m = i + n / 2;
+
+      if (depth == 0) {
+         p = median_of_medians(a, esize, i, k, pval, temp, compare);
+      }
+      else if (n >= SELECT_NINTHER) {
+         depth--;
+         s = n / 8;
+         p = median3(a, esize,
+                     median3(a, esize, i, i + s, i + 2 * s, compare),
+                     median3(a, esize, m - s, m, m + s, compare),
+                     median3(a, esize, k - 2 * s, k - s, k, compare), compare);
+      }
+      else {
+         depth--;
+         p = median3(a, esize, i, m, k, compare);
+      }
+
+      memcpy(pval, &a[(size_t)p * esize], esize);
+
+      /* Create three partitions: less than, equal to, and greater than the partition value. */
+      lt = i;
+      gt = k;
+      j = i;
+
+      while (j <= gt) {
+         c = compare(&a[(size_t)j * esize], pval);
+
+         if (c < 0) {
+            if (lt != j)
+               swap(&a[(size_t)lt * esize], &a[(size_t)j * esize], esize, temp);
+            lt++;
+            j++;
+         }
+         else if (c > 0) {
+            swap(&a[(size_t)j * esize], &a[(size_t)gt * esize], esize, temp);
+            gt--;
+         }
+         else {
+            j++;
+         }
+      }
+
+      /* Continue in the partition holding the target, unless the target equals the partition value. */
+      if (target < lt)
+         k = lt - 1;
+      else if (target > gt)
+         i = gt + 1;
+      else
+         return;
+   }
+
+   /* Finish small partitions with insertion sort. */
+   insertion(a, esize, i, k, temp, compare);
+}
+
+int select_kth(void *data, int size, int esize, int k, int (*compare)(const void *key1, const void *key2))
+{
+   char stack[SELECT_STACK];
+   char *scratch;
+   int depth, n;
+
+   if (k < 0 || k >= size)
+      return -1;
+
+   /* Use storage on the stack for the partition value and swapping, unless elements are large. */
+   if (esize * 2 <= SELECT_STACK)
+      scratch = stack;
+   else if ((scratch = (char *)malloc(esize * 2)) == NULL)
+      return -1;
+
+   /* Allow twice the ideal number of partitions before switching to the median of medians. */
+   for (depth = 0, n = size; n > 1; n >>= 1)
+      depth += 2;
+
+   select_range(data, esize, 0, size - 1, k, depth, scratch, scratch + esize, compare);
+
+   /* Free the storage allocated for selecting. */
+   if (scratch != stack)
+      free(scratch);
+
+   return 0;
+}
+
+static void insertion_int(int *a, int i, int k)
+{
+   int key, j, m;
+
+   for (j = i + 1; j <= k; j++) {
+      key = a[j];
+
+      for (m = j - 1; m >= i && a[m] > key; m--)
+         a[m + 1] = a[m];
+
+      a[m + 1] = key;
+   }
+}
+
+static int median3_int(const int *a, int x, int y, int z)
+{
+   if (a[x] < a[y])
+      return a[y] < a[z] ? y : (a[x] < a[z] ? z : x);
+   else
+      return a[y] > a[z] ? y : (a[x] > a[z] ? z : x);
+}
+
+static void select_range_int(int *a, int i, int k, int target, int depth);
+
+static int median_of_medians_int(int *a, int i, int k)
+{
+   int g, e, m, t;
+
+   /* Sort each group of five elements, and gather the medians of the groups at the front. */
+   for (g = i, m = i; g <= k; g += 5, m++) {
+      e = g + 4 <= k ? g + 4 : k;
+      insertion_int(a, g, e);
+      t = a[m];
+      a[m] = a[g + (e - g) / 2];
+      a[g + (e - g) / 2] = t;
+   }
+
+   select_range_int(a, i, m - 1, i + (m - 1 - i) / 2, 0);
+
+   return i + (m - 1 - i) / 2;
+}
+
+static void select_range_int(int *a, int i, int k, int target, int depth)
+{
+   int n, s, m, p, pval, lt, gt, j, t;
+
+   while ((n = k - i + 1) > SELECT_CUTOFF) {
+      /* Select the partition value, using the median of medians once partitioning degrades. */
+      m = i + n / 2;
+
+      if (depth == 0) {
+         p = median_of_medians_int(a, i, k);
+      }
+      else if (n >= SELECT_NINTHER) {
+         depth--;
+         s = n / 8;
+         p = median3_int(a, median3_int(a, i, i + s, i + 2 * s), median3_int(a, m - s, m, m + s),
+                         median3_int(a, k - 2 * s, k - s, k));
+      }
+      else {
+         depth--;
+         p = median3_int(a, i, m, k);
+      }
+
+      pval = a[p];
+
+      /* Create three partitions: less than, equal to, and greater than the partition value. */
+      lt = i;
+      gt = k;
+      j = i;
+
+      while (j <= gt) {
+         if (a[j] < pval) {
+            t = a[lt];
+            a[lt++] = a[j];
+            a[j++] = t;
+         }
+         else if (a[j] > pval) {
+            t = a[gt];
+            a[gt--] = a[j];
+            a[j] = t;
+         }
+         else {
+            j++;
+         }
+      }
+
+      /* Continue in the partition holding the target, unless the target equals the partition value. */
+      if (target < lt)
+         k = lt - 1;
+      else if (target > gt)
+         i = gt + 1;
+      else
+         return;
+   }
+
+   insertion_int(a, i, k);
+}
+
+int select_kth_int(int *data, int size, int k)
+{
+   int depth, n;
+
+   if (k < 0 || k >= size)
+      return -1;
+
+   /* Allow twice the ideal number of partitions before switching to the median of medians. */
+   for (depth = 0, n = size; n > 1; n >>= 1)
+      depth += 2;
+
+   select_range_int(data, 0, size - 1, k, depth);
+
+   return 0;
+}
@@ -0,0 +1,213 @@
+/**
+ * @file smedian.c
+ * @date 16 October 2026
+ * @brief Implementation of the Streaming Median Abstract Datatype
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "smedian.h"
+
+/* 
+ * Define private macros used by the streaming median implementation.
+ */
+
+#define smedian_heap(median, side) ((side) == 0 ? &(median)->lower : &(median)->upper)
+
+static int compare_lower(const void *key1, const void *key2)
+{
+    const SMedianEntry *entry1 = key1, *entry2 = key2;
+
+    /* The top of the lower heap is its greatest sample. */
+    return entry1->owner->compare(entry1->data, entry2->data);
+}
+
+static int compare_upper(const void *key1, const void *key2)
+{
+    const SMedianEntry *entry1 = key1, *entry2 = key2;
+
+    /* The top of the upper heap is its least sample. */
+    return entry1->owner->compare(entry2->data, entry1->data);
+}
+
+static int lower_size(const SMedian *median, int size)
+{
+    /* Determine how many samples are at or below the quantile among size samples. */
+    return size == 0 ? 0 : (int)(median->quantile * (size - 1)) + 1;
+}
+
+static int move(SMedian *median, int from)
+{
+    SMedianEntry *entry;
+    void *data;
+    int handle;
+
+    /* Insert the top of one heap into the other before removing it, so a failure loses nothing. */
+    entry = iheap_peek(smedian_heap(median, from));
+
+    if (iheap_insert(smedian_heap(median, !from), entry, &handle) != 0)
+        return -1;
+
+    iheap_remove(smedian_heap(median, from), entry->handle, &data);
+    entry->side = !from;
+    entry->handle = handle;
+
+    return 0;
+}
+
+static int rebalance(SMedian *median)
+{
+    int target = lower_size(median, median->size);
+
+    /* Move samples between the heaps until the lower heap ends at the quantile. */
+    while (iheap_size(&median->lower) > target)
+    {
+        if (move(median, 0) != 0)
+            return -1;
+    }
+
+    while (iheap_size(&median->lower) < target)
+    {
+        if (move(median, 1) != 0)
+            return -1;
+    }
+
+    return 0;
+}
+
+static int remove_entry(SMedian *median, SMedianEntry *entry)
+{
+    void *data;
+
+    /* Remove the sample from its heap. */
+    iheap_remove(smedian_heap(median, entry->side), entry->handle, &data);
+    median->size--;
+
+    return rebalance(median);
+}
+
+int smedian_init(SMedian *median, double quantile, int window,
+                 int (*compare)(const void *key1, const void *key2), void (*destroy)(void *data))
+{
+    if (!(quantile >= 0.0 && quantile <= 1.0) || window < 0)
+        return -1;
+
+    /* Allocate storage for the samples of a sliding window. */
+    if (window > 0)
+    {
+        if ((median->ring = (SMedianEntry *)malloc(window * sizeof(SMedianEntry))) == NULL)
+            return -1;
+    }
+    else
+    {
+        median->ring = NULL;
+    }
+
+    /* Initialize the streaming median. */
+    median->size = 0;
+    median->quantile = quantile;
+    median->window = window;
+    median->compare = compare;
+    median->destroy = destroy;
+    median->oldest = 0;
+
+    iheap_init(&median->lower, compare_lower, NULL);
+    iheap_init(&median->upper, compare_upper, NULL);
+
+    return 0;
+}
+
+void smedian_destroy(SMedian *median)
+{
+    SMedianEntry *entry;
+    void *data;
+    int side;
+
+    /* Remove all the samples from both heaps. */
+    for (side = 0; side < 2; side++)
+    {
+        while (iheap_extract(smedian_heap(median, side), &data) == 0)
+        {
+            entry = data;
+
+            /* Call a user-defined function to free dynamically allocated data. */
+            if (median->destroy != NULL)
+                median->destroy(entry->data);
+
+            if (median->window == 0)
+                free(entry);
+        }
+    }
+
+    /* Free the storage allocated for the streaming median. */
+    iheap_destroy(&median->lower);
+    iheap_destroy(&median->upper);
+    free(median->ring);
+
+    /* No operations are allowed now, but clear the structure as a precaution. */
+    memset(median, 0, sizeof(SMedian));
+
+    return;
+}
+
+int smedian_insert(SMedian *median, const void *data)
+{
+    SMedianEntry *entry, *top;
+    void *expired;
+    int side;
+
+    /* Expire the oldest sample of a full window, and reuse its entry. */
+    if (median->window > 0)
+    {
+        if (median->size == median->window)
+        {
+            smedian_expire(median, &expired);
+
+            if (median->destroy != NULL)
+                median->destroy(expired);
+        }
+
+        entry = &median->ring[(median->oldest + median->size) % median->window];
+    }
+    else if ((entry = (SMedianEntry *)malloc(sizeof(SMedianEntry))) == NULL)
+    {
+        return -1;
+    }
+
+    entry->data = (void *)data;
+    entry->owner = median;
+
+    /* Insert the sample into the lower heap if it is no greater than the quantile. */
+    top = iheap_peek(&median->lower);
+    side = top != NULL && median->compare(data, top->data) > 0;
+
+    if (iheap_insert(smedian_heap(median, side), entry, &entry->handle) != 0)
+    {
+        if (median->window == 0)
+            free(entry);
+
+        return -1;
+    }
+
+    entry->side = side;
+    median->size++;
+
+    return rebalance(median);
+}
+
+int smedian_expire(SMedian *median, void **data)
+{
+    SMedianEntry *entry;
+
+    /* Do not allow expiring from an empty window, or without a window. */
+    if (median->window == 0 || median->size == 0)
+        return -1;
+
+    /* Remove the oldest sample. */
+    entry = &median->ring[median->oldest];
+    *data = entry->data;
+    median->oldest = (median->oldest + 1) % median->window;
+
+    return remove_entry(median, entry);
+}
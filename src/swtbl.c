@@ -0,0 +1,312 @@
+/**
+ * @file swtbl.c
+ * @date 16 October 2026
+ * @brief Implementation of the Group-Probed Hash Table Abstract Datatype
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "swtbl.h"
+
+/*
+ * Define the control bytes of positions that hold no element. Both are negative, so their high bit
+ * tells them apart from the 7-bit tags of occupied positions.
+ */
+
+#define SWTBL_EMPTY   ((signed char)-128)
+#define SWTBL_DELETED ((signed char)-2)
+
+/*
+ * Define private macros used to split the mixed hash of a key into a 7-bit tag and a first group.
+ */
+
+#define swtbl_mix(htbl, key) ((uint64_t)(uint32_t)(htbl)->h(key) * 0x9E3779B97F4A7C15ULL)
+
+#define swtbl_tag(hash) ((signed char)((hash) >> 57))
+
+#define swtbl_group(hash, groups) ((int)(((hash) >> 24) & (uint64_t)((groups) - 1)))
+
+static unsigned int group_match(const signed char *ctrl, signed char tag)
+{
+#ifdef __SSE2__
+    /* Compare the 16 control bytes of the group with the tag at once. */
+    __m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+
+    return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(tag)));
+#else
+    unsigned int mask = 0;
+    int i;
+
+    for (i = 0; i < SWTBL_GROUP; i++)
+    {
+        if (ctrl[i] == tag)
+            mask |= 1U << i;
+    }
+
+    return mask;
+#endif
+}
+
+static unsigned int group_free(const signed char *ctrl)
+{
+#ifdef __SSE2__
+    /* Select the empty and deleted positions of the group by their high bit. */
+    return (unsigned int)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)ctrl));
+#else
+    unsigned int mask = 0;
+    int i;
+
+    for (i = 0; i < SWTBL_GROUP; i++)
+    {
+        if (ctrl[i] < 0)
+            mask |= 1U << i;
+    }
+
+    return mask;
+#endif
+}
+
+static int find(const SwTbl *htbl, const void *data)
+{
+    uint64_t hash;
+    unsigned int mask;
+    signed char tag;
+    int groups, group, probe, position;
+
+    hash = swtbl_mix(htbl, data);
+    tag = swtbl_tag(hash);
+    groups = htbl->positions / SWTBL_GROUP;
+    group = swtbl_group(hash, groups);
+
+    /* Probe one group at a time, using triangular steps that visit every group. */
+    for (probe = 0; probe < groups; probe++)
+    {
+        /* Call the match function only for positions with the same tag as the key. */
+        mask = group_match(&htbl->ctrl[group * SWTBL_GROUP], tag);
+
+        while (mask != 0)
+        {
+            position = group * SWTBL_GROUP + __builtin_ctz(mask);
+
+            if (htbl->match(htbl->table[position], data))
+                return position;
+
+            mask &= mask - 1;
+        }
+
+        /* A group with an empty position ends the probe sequence of every key. */
+        if (group_match(&htbl->ctrl[group * SWTBL_GROUP], SWTBL_EMPTY) != 0)
+            return -1;
+
+        group = (group + probe + 1) & (groups - 1);
+    }
+
+    return -1;
+}
+
+static void place(SwTbl *htbl, const void *data)
+{
+    uint64_t hash;
+    unsigned int mask;
+    int groups, group, probe, position;
+
+    hash = swtbl_mix(htbl, data);
+    groups = htbl->positions / SWTBL_GROUP;
+    group = swtbl_group(hash, groups);
+
+    /* Use the first empty or deleted position in the probe sequence of the key. */
+    for (probe = 0; (mask = group_free(&htbl->ctrl[group * SWTBL_GROUP])) == 0; probe++)
+        group = (group + probe + 1) & (groups - 1);
+
+    position = group * SWTBL_GROUP + __builtin_ctz(mask);
+
+    if (htbl->ctrl[position] == SWTBL_DELETED)
+        htbl->deleted--;
+
+    htbl->ctrl[position] = swtbl_tag(hash);
+    htbl->table[position] = (void *)data;
+    htbl->size++;
+
+    return;
+}
+
+static int alloc(SwTbl *htbl, int positions)
+{
+    /* Allocate space for the control bytes and the elements. */
+    if ((htbl->ctrl = (signed char *)malloc(positions)) == NULL)
+        return -1;
+
+    if ((htbl->table = (void **)malloc(positions * sizeof(void *))) == NULL)
+    {
+        free(htbl->ctrl);
+        return -1;
+    }
+
+    /* Initialize each position as empty. */
+    memset(htbl->ctrl, SWTBL_EMPTY, positions);
+    htbl->positions = positions;
+    htbl->size = 0;
+    htbl->deleted = 0;
+
+    return 0;
+}
+
+static int rehash(SwTbl *htbl, int positions)
+{
+    signed char *ctrl;
+    void **table;
+    int old_positions, i;
+
+    ctrl = htbl->ctrl;
+    table = htbl->table;
+    old_positions = htbl->positions;
+
+    /* Keep the current positions if the new ones cannot be allocated. */
+    if (alloc(htbl, positions) != 0)
+    {
+        htbl->ctrl = ctrl;
+        htbl->table = table;
+        return -1;
+    }
+
+    /* Reinsert every element, dropping the deleted positions. */
+    for (i = 0; i < old_positions; i++)
+    {
+        if (ctrl[i] >= 0)
+            place(htbl, table[i]);
+    }
+
+    free(ctrl);
+    free(table);
+
+    return 0;
+}
+
+int swtbl_init(SwTbl *htbl, int positions, int (*h)(const void *key),
+               int (*match)(const void *key1, const void *key2), void (*destroy)(void *data))
+{
+    int n;
+
+    /* Round the positions up to a power of two that fills whole groups. */
+    for (n = SWTBL_GROUP; n < positions && n <= (1 << 29); n *= 2)
+        ;
+
+    if (alloc(htbl, n) != 0)
+        return -1;
+
+    /* Encapsulate the functions. */
+    htbl->h = h;
+    htbl->match = match;
+    htbl->destroy = destroy;
+
+    return 0;
+}
+
+void swtbl_destroy(SwTbl *htbl)
+{
+    int i;
+
+    if (htbl->destroy != NULL)
+    {
+        /* Call a user-defined function to free dynamically allocated data. */
+        for (i = 0; i < htbl->positions; i++)
+        {
+            if (htbl->ctrl[i] >= 0)
+                htbl->destroy(htbl->table[i]);
+        }
+    }
+
+    /* Free the storage allocated for the hash table. */
+    free(htbl->ctrl);
+    free(htbl->table);
+
+    /* No operations are allowed now, but clear the structure as a precaution. */
+    memset(htbl, 0, sizeof(SwTbl));
+
+    return;
+}
+
+int swtbl_insert(SwTbl *htbl, const void *data)
+{
+    int positions;
+
+    /* Do nothing if the data is already in the table. */
+    if (find(htbl, data) >= 0)
+        return 1;
+
+    /* Rehash when the table would be more than 7/8 full, growing unless deletions fill it. */
+    if ((htbl->size + htbl->deleted + 1) > htbl->positions - htbl->positions / 8)
+    {
+        if (htbl->size + 1 > htbl->positions / 2)
+        {
+            if (htbl->positions > (1 << 29))
+                return -1;
+
+            positions = htbl->positions * 2;
+        }
+        else
+        {
+            positions = htbl->positions;
+        }
+
+        if (rehash(htbl, positions) != 0)
+            return -1;
+    }
+
+    /* Insert the data into the table. */
+    place(htbl, data);
+
+    return 0;
+}
+
+int swtbl_remove(SwTbl *htbl, void **data)
+{
+    int position, group;
+
+    /* Return that the data was not found. */
+    if ((position = find(htbl, *data)) < 0)
+        return -1;
+
+    /* Pass back the data from the table. */
+    *data = htbl->table[position];
+
+    /*
+     * A group that already has an empty position ends every probe sequence that reaches it, so the
+     * position can become empty again. Otherwise it must be marked as deleted.
+     */
+    group = position - position % SWTBL_GROUP;
+
+    if (group_match(&htbl->ctrl[group], SWTBL_EMPTY) != 0)
+    {
+        htbl->ctrl[position] = SWTBL_EMPTY;
+    }
+    else
+    {
+        htbl->ctrl[position] = SWTBL_DELETED;
+        htbl->deleted++;
+    }
+
+    htbl->size--;
+
+    return 0;
+}
+
+int swtbl_lookup(const SwTbl *htbl, void **data)
+{
+    int position;
+
+    /* Return that the data was not found. */
+    if ((position = find(htbl, *data)) < 0)
+        return -1;
+
+    /* Pass back the data from the table. */
+    *data = htbl->table[position];
+
+    return 0;
+}
@@ -0,0 +1,317 @@
+/**
+ * @file tpool.c
+ * @date 16 October 2026
+ * @brief Implementation of the Work-Stealing Thread Pool.
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tpool.h"
+
+/*
+ * Define the smallest capacity allocated for a deque of tasks.
+ */
+
+#define TPOOL_MIN_CAPACITY 16
+
+/*
+ * Define the pool and worker of the calling thread, if it is a worker.
+ */
+
+static _Thread_local const TPool *current_pool = NULL;
+static _Thread_local int current_id = -1;
+
+static int push(TPoolDeque *deque, void (*run)(void *arg), void *arg)
+{
+    TPoolTask *tasks;
+    int capacity, first;
+
+    pthread_mutex_lock(&deque->lock);
+
+    /* Double the storage for the tasks when the deque is full, unwrapping the tasks. */
+    if (deque->size == deque->capacity)
+    {
+        capacity = deque->capacity == 0 ? TPOOL_MIN_CAPACITY : deque->capacity * 2;
+
+        if ((tasks = (TPoolTask *)malloc(capacity * sizeof(TPoolTask))) == NULL)
+        {
+            pthread_mutex_unlock(&deque->lock);
+            return -1;
+        }
+
+        first = deque->capacity - deque->head;
+
+        if (first > deque->size)
+            first = deque->size;
+
+        if (deque->size > 0)
+        {
+            memcpy(tasks, &deque->tasks[deque->head], first * sizeof(TPoolTask));
+            memcpy(&tasks[first], deque->tasks, (deque->size - first) * sizeof(TPoolTask));
+        }
+
+        free(deque->tasks);
+        deque->tasks = tasks;
+        deque->capacity = capacity;
+        deque->head = 0;
+    }
+
+    /* Add the task at the tail. */
+    tasks = &deque->tasks[(deque->head + deque->size) & (deque->capacity - 1)];
+    tasks->run = run;
+    tasks->arg = arg;
+    deque->size++;
+
+    pthread_mutex_unlock(&deque->lock);
+
+    return 0;
+}
+
+static int pop(TPoolDeque *deque, int steal, TPoolTask *task)
+{
+    int found = 0;
+
+    pthread_mutex_lock(&deque->lock);
+
+    if (deque->size > 0)
+    {
+        if (steal)
+        {
+            /* Steal the oldest task from the head. */
+            *task = deque->tasks[deque->head];
+            deque->head = (deque->head + 1) & (deque->capacity - 1);
+        }
+        else
+        {
+            /* Take the newest task from the tail. */
+            *task = deque->tasks[(deque->head + deque->size - 1) & (deque->capacity - 1)];
+        }
+
+        deque->size--;
+        found = 1;
+    }
+
+    pthread_mutex_unlock(&deque->lock);
+
+    return found;
+}
+
+static int take(TPool *pool, int id, TPoolTask *task)
+{
+    int i;
+
+    /* Run the newest task of the worker first, since its data is most likely in the cache. */
+    if (pop(&pool->deques[id], 0, task))
+        return 1;
+
+    /* Steal from the other deques, starting with the next worker to spread the thefts. */
+    for (i = 1; i <= pool->nworkers; i++)
+    {
+        if (pop(&pool->deques[(id + i) % (pool->nworkers + 1)], 1, task))
+            return 1;
+    }
+
+    return 0;
+}
+
+static void *run_worker(void *arg)
+{
+    TPoolWorker *worker = arg;
+    TPool *pool = worker->pool;
+    TPoolTask task;
+
+    current_pool = pool;
+    current_id = worker->id;
+
+    while (1)
+    {
+        if (take(pool, worker->id, &task))
+        {
+            pthread_mutex_lock(&pool->lock);
+            pool->queued--;
+            pthread_mutex_unlock(&pool->lock);
+
+            task.run(task.arg);
+
+            /* Wake the threads waiting for the pool once the last task has finished. */
+            pthread_mutex_lock(&pool->lock);
+
+            if (--pool->pending == 0)
+                pthread_cond_broadcast(&pool->done);
+
+            pthread_mutex_unlock(&pool->lock);
+            continue;
+        }
+
+        /* Sleep until a task is submitted, or the pool is destroyed. */
+        pthread_mutex_lock(&pool->lock);
+
+        while (pool->queued == 0 && !pool->stop)
+            pthread_cond_wait(&pool->work, &pool->lock);
+
+        if (pool->queued == 0 && pool->stop)
+        {
+            pthread_mutex_unlock(&pool->lock);
+            break;
+        }
+
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    current_pool = NULL;
+    current_id = -1;
+
+    return NULL;
+}
+
+static void stop(TPool *pool, int nstarted)
+{
+    int i;
+
+    /* Wake the workers so that they see the pool is stopping, and wait for them to exit. */
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < nstarted; i++)
+        pthread_join(pool->workers[i].thread, NULL);
+
+    /* Free the storage allocated for the deques and workers. */
+    for (i = 0; i <= pool->nworkers; i++)
+    {
+        free(pool->deques[i].tasks);
+        pthread_mutex_destroy(&pool->deques[i].lock);
+    }
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->work);
+    pthread_mutex_destroy(&pool->lock);
+
+    free(pool->deques);
+    free(pool->workers);
+
+    return;
+}
+
+int tpool_init(TPool *pool, int nworkers)
+{
+    long ncpus;
+    int i;
+
+    /* Use a worker for each processor by default. */
+    if (nworkers < 1)
+    {
+        ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nworkers = ncpus > 0 ? (int)ncpus : 1;
+    }
+
+    /* Allocate storage for the workers and their deques. */
+    pool->nworkers = nworkers;
+    pool->queued = 0;
+    pool->pending = 0;
+    pool->stop = 0;
+
+    pool->workers = (TPoolWorker *)malloc(nworkers * sizeof(TPoolWorker));
+    pool->deques = (TPoolDeque *)malloc((nworkers + 1) * sizeof(TPoolDeque));
+
+    if (pool->workers == NULL || pool->deques == NULL)
+    {
+        free(pool->workers);
+        free(pool->deques);
+        return -1;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for (i = 0; i <= nworkers; i++)
+    {
+        pool->deques[i].tasks = NULL;
+        pool->deques[i].capacity = 0;
+        pool->deques[i].head = 0;
+        pool->deques[i].size = 0;
+        pthread_mutex_init(&pool->deques[i].lock, NULL);
+    }
+
+    /* Start the workers. */
+    for (i = 0; i < nworkers; i++)
+    {
+        pool->workers[i].pool = pool;
+        pool->workers[i].id = i;
+
+        if (pthread_create(&pool->workers[i].thread, NULL, run_worker, &pool->workers[i]) != 0)
+        {
+            stop(pool, i);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+void tpool_destroy(TPool *pool)
+{
+    /* Let the tasks submitted finish before stopping the workers. */
+    tpool_wait(pool);
+    stop(pool, pool->nworkers);
+
+    /* No operations are allowed now, but clear the structure as a precaution. */
+    memset(pool, 0, sizeof(TPool));
+
+    return;
+}
+
+int tpool_submit(TPool *pool, void (*run)(void *arg), void *arg)
+{
+    int id;
+
+    /* 
+     * Account for the task before it is in a deque, so that it cannot finish before it counts as
+     * pending. A worker woken meanwhile retries until the task is in the deque.
+     */
+    pthread_mutex_lock(&pool->lock);
+    pool->pending++;
+    pool->queued++;
+    pthread_cond_signal(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    /* Workers add tasks to their own deques, and other threads to the last deque. */
+    id = tpool_worker_id(pool);
+
+    if (push(&pool->deques[id >= 0 ? id : pool->nworkers], run, arg) != 0)
+    {
+        pthread_mutex_lock(&pool->lock);
+        pool->queued--;
+
+        if (--pool->pending == 0)
+            pthread_cond_broadcast(&pool->done);
+
+        pthread_mutex_unlock(&pool->lock);
+        return -1;
+    }
+
+    return 0;
+}
+
+void tpool_wait(TPool *pool)
+{
+    /* Sleep until no task is pending. */
+    pthread_mutex_lock(&pool->lock);
+
+    while (pool->pending > 0)
+        pthread_cond_wait(&pool->done, &pool->lock);
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return;
+}
+
+int tpool_worker_id(const TPool *pool)
+{
+    return current_pool == pool ? current_id : -1;
+}